@@ -0,0 +1,291 @@
+// GameMap benchmark: generates synthetic text maps of increasing size in each token style,
+// then measures map construction throughput and the AreaIsAvailable / DamageAtWorldPosition
+// query rates. Results are written as JSON so they can be compared across commits.
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "gamemap.h"
+
+namespace {
+constexpr int kCols = 32;
+constexpr int kGridSize = 20;
+constexpr std::uint32_t kSeed = 20240613u;
+constexpr double kMinLoadSeconds = 0.25;
+constexpr int kMinLoadIterations = 3;
+constexpr long kQueryCount = 4000000;
+constexpr long kDamageCount = 1000000;
+constexpr long kQuickQueryCount = 20000;
+constexpr long kQuickDamageCount = 5000;
+constexpr std::size_t kMapHeaderSize = 64;
+
+// Packed subtile entries (low byte tile id, high byte spec: health | destruction << 3 |
+// movement << 6), written in hex like the map maker does.
+constexpr const char* kWallEntry = "0x0B01";   // health 3, normal destruction, no pass
+constexpr const char* kFloorEntry = "0x0000";  // health 0: walkable
+
+enum class TokenStyle { kLegacy, kPacked, kHeader };
+
+struct Options {
+    bool quick{false};
+    std::string output_path;
+    std::filesystem::path work_dir;
+};
+
+struct LoadResult {
+    int iterations{0};
+    double seconds_per_load{0.0};
+};
+
+struct RateResult {
+    long calls{0};
+    long hits{0};
+    double seconds{0.0};
+};
+
+const char* style_name(TokenStyle style) {
+    switch (style) {
+        case TokenStyle::kLegacy:
+            return "legacy";
+        case TokenStyle::kPacked:
+            return "packed";
+        case TokenStyle::kHeader:
+            return "mmd1";
+    }
+    return "unknown";
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double per_second(double count, double seconds) {
+    return seconds > 0.0 ? count / seconds : 0.0;
+}
+
+// Border walls and roughly one blocked cell in four inside, from a fixed seed so every run
+// (and every commit) benchmarks the same maps.
+std::vector<std::uint8_t> make_layout(int rows, int cols) {
+    std::mt19937 rng(kSeed + static_cast<std::uint32_t>(rows));
+    std::uniform_int_distribution<int> roll(0, 3);
+    std::vector<std::uint8_t> blocked(static_cast<std::size_t>(rows) * cols, 0);
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            const bool border = row == 0 || col == 0 || row == rows - 1 || col == cols - 1;
+            blocked[static_cast<std::size_t>(row) * cols + col] = border || roll(rng) == 0;
+        }
+    }
+    return blocked;
+}
+
+void write_packed_token(std::ostream& out, bool blocked) {
+    out << (blocked ? 1 : 0) << '|';
+    for (int i = 0; i < GameMap::kSubtilesPerCell; ++i) {
+        out << (i == 0 ? "" : ",") << (blocked ? kWallEntry : kFloorEntry);
+    }
+}
+
+bool write_map(const std::filesystem::path& path, TokenStyle style, int rows, int cols) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    if (style == TokenStyle::kHeader) {
+        std::string header(kMapHeaderSize, '\0');
+        header.replace(0, 4, "MMD1");
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    }
+
+    const std::vector<std::uint8_t> blocked = make_layout(rows, cols);
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            if (col > 0) {
+                out << ' ';
+            }
+            const bool cell_blocked = blocked[static_cast<std::size_t>(row) * cols + col] != 0;
+            if (style == TokenStyle::kLegacy) {
+                out << (cell_blocked ? 1 : 0);
+            } else {
+                write_packed_token(out, cell_blocked);
+            }
+        }
+        out << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+LoadResult bench_load(const std::string& path, int rows, bool quick) {
+    LoadResult result;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do {
+        GameMap map(rows, kCols, kGridSize, path, 0);
+        if (!map.MatchesDimensions(rows, kCols)) {
+            std::cerr << "Warning: Benchmark map '" << path << "' loaded as " << map.RowCount()
+                      << "x" << map.ColCount() << ".\n";
+        }
+        ++result.iterations;
+        elapsed = seconds_since(start);
+    } while (!quick && (elapsed < kMinLoadSeconds || result.iterations < kMinLoadIterations));
+
+    result.seconds_per_load = elapsed / result.iterations;
+    return result;
+}
+
+RateResult bench_area_is_available(const GameMap& map, long count) {
+    // Coordinates are drawn up front so the timed loop only measures the lookups.
+    std::mt19937 rng(kSeed);
+    std::uniform_int_distribution<int> row_dist(0, map.RowCount() - 1);
+    std::uniform_int_distribution<int> col_dist(0, map.ColCount() - 1);
+    std::vector<int> rows(static_cast<std::size_t>(count));
+    std::vector<int> cols(static_cast<std::size_t>(count));
+    for (long i = 0; i < count; ++i) {
+        rows[i] = row_dist(rng);
+        cols[i] = col_dist(rng);
+    }
+
+    RateResult result;
+    result.calls = count;
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < count; ++i) {
+        result.hits += map.AreaIsAvailable(rows[i], cols[i]) ? 1 : 0;
+    }
+    result.seconds = seconds_since(start);
+    return result;
+}
+
+RateResult bench_damage(GameMap map, long count) {
+    std::mt19937 rng(kSeed + 1);
+    std::uniform_int_distribution<int> x_dist(0, map.ColCount() * kGridSize - 1);
+    std::uniform_int_distribution<int> y_dist(0, map.RowCount() * kGridSize - 1);
+    std::vector<int> xs(static_cast<std::size_t>(count));
+    std::vector<int> ys(static_cast<std::size_t>(count));
+    for (long i = 0; i < count; ++i) {
+        xs[i] = x_dist(rng);
+        ys[i] = y_dist(rng);
+    }
+
+    RateResult result;
+    result.calls = count;
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < count; ++i) {
+        result.hits += map.DamageAtWorldPosition(xs[i], ys[i]) ? 1 : 0;
+    }
+    result.seconds = seconds_since(start);
+    return result;
+}
+
+void write_rate(std::ostream& out, const char* name, const RateResult& rate, bool last) {
+    out << "      \"" << name << "\": {\"calls\": " << rate.calls << ", \"hits\": " << rate.hits
+        << ", \"seconds\": " << rate.seconds
+        << ", \"calls_per_sec\": " << per_second(static_cast<double>(rate.calls), rate.seconds)
+        << "}" << (last ? "\n" : ",\n");
+}
+
+bool parse_args(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--quick") {
+            options->quick = true;
+        } else if (arg == "--output" && i + 1 < argc) {
+            options->output_path = argv[++i];
+        } else if (arg == "--dir" && i + 1 < argc) {
+            options->work_dir = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_usage() {
+    std::cout << "Usage: bench_gamemap [--quick] [--output PATH] [--dir PATH]\n"
+                 "  --quick        one small pass per case (smoke test)\n"
+                 "  --output PATH  write the JSON results to PATH instead of stdout\n"
+                 "  --dir PATH     directory for the generated maps (default: temp dir)\n";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parse_args(argc, argv, &options)) {
+        print_usage();
+        return argc > 1 && std::string(argv[1]) == "--help" ? 0 : 1;
+    }
+
+    std::error_code error;
+    if (options.work_dir.empty()) {
+        options.work_dir = std::filesystem::temp_directory_path(error) / "bench_gamemap";
+    }
+    std::filesystem::create_directories(options.work_dir, error);
+    if (error) {
+        std::cerr << "Error: Cannot create benchmark directory '" << options.work_dir.string()
+                  << "'.\n";
+        return 1;
+    }
+
+    const std::vector<int> row_counts =
+        options.quick ? std::vector<int>{20, 200} : std::vector<int>{20, 200, 2000, 20000};
+    const long query_count = options.quick ? kQuickQueryCount : kQueryCount;
+    const long damage_count = options.quick ? kQuickDamageCount : kDamageCount;
+    const TokenStyle styles[] = {TokenStyle::kLegacy, TokenStyle::kPacked, TokenStyle::kHeader};
+
+    std::ofstream file_out;
+    if (!options.output_path.empty()) {
+        file_out.open(options.output_path, std::ios::trunc);
+        if (!file_out.is_open()) {
+            std::cerr << "Error: Cannot write '" << options.output_path << "'.\n";
+            return 1;
+        }
+    }
+    std::ostream& out = options.output_path.empty() ? std::cout : file_out;
+
+    out << "{\n  \"benchmark\": \"bench_gamemap\",\n  \"quick\": "
+        << (options.quick ? "true" : "false") << ",\n  \"cols\": " << kCols
+        << ",\n  \"grid_size\": " << kGridSize << ",\n  \"results\": [\n";
+    bool first = true;
+    for (TokenStyle style : styles) {
+        for (int rows : row_counts) {
+            const std::filesystem::path path =
+                options.work_dir / (std::string(style_name(style)) + "_" +
+                                    std::to_string(rows) + ".map");
+            if (!write_map(path, style, rows, kCols)) {
+                std::cerr << "Error: Cannot write benchmark map '" << path.string() << "'.\n";
+                return 1;
+            }
+            const std::uintmax_t file_bytes = std::filesystem::file_size(path, error);
+
+            const LoadResult load = bench_load(path.string(), rows, options.quick);
+            const GameMap map(rows, kCols, kGridSize, path.string(), 0);
+            const RateResult area = bench_area_is_available(map, query_count);
+            const RateResult damage = bench_damage(map, damage_count);
+            std::filesystem::remove(path, error);
+
+            const double cells = static_cast<double>(rows) * kCols;
+            out << (first ? "" : ",\n") << "    {\n      \"style\": \"" << style_name(style)
+                << "\",\n      \"rows\": " << rows << ",\n      \"file_bytes\": " << file_bytes
+                << ",\n      \"load\": {\"iterations\": " << load.iterations
+                << ", \"ms_per_load\": " << load.seconds_per_load * 1000.0
+                << ", \"mb_per_sec\": "
+                << per_second(static_cast<double>(file_bytes) / 1.0e6, load.seconds_per_load)
+                << ", \"cells_per_sec\": " << per_second(cells, load.seconds_per_load) << "},\n";
+            write_rate(out, "area_is_available", area, false);
+            write_rate(out, "damage_at_world_position", damage, true);
+            out << "    }";
+            first = false;
+        }
+    }
+    out << "\n  ]\n}\n";
+
+    if (!out) {
+        std::cerr << "Error: Failed to write benchmark results.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,324 @@
+// Renderer benchmark: runs the game on synthetic maps of increasing destructible density and
+// times every Renderer::Render() call against an offscreen software renderer (SDL's dummy
+// video driver unless SDL_VIDEODRIVER says otherwise), so no GPU or display is needed.
+// Reports p50/p99 frame times and draw-call counts as JSON.
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "../shared/sdl_framework/sdl_context.h"
+#include "AICentral.h"
+#include "SDL3/SDL.h"
+#include "constants.h"
+#include "game.h"
+#include "gamemap.h"
+#include "path_resolver.h"
+#include "player_input.h"
+#include "renderer.h"
+
+namespace {
+constexpr std::uint32_t kSeed = 20240613u;
+constexpr int kFrames = 2000;
+constexpr int kQuickFrames = 60;
+constexpr int kFireInterval = 8;
+constexpr int kTurnInterval = 45;
+constexpr float kAlpha = 0.5f;
+constexpr const char* kDefaultOutput = "bench_renderer.json";
+
+// Packed subtile entries (low byte tile id, high byte spec: health | destruction << 3 |
+// movement << 6), written in hex like the map maker does.
+constexpr const char* kBorderEntry = "0x0101";        // health 1, indestructible, no pass
+constexpr const char* kDestructibleEntry = "0x0B01";  // health 3, normal destruction, no pass
+constexpr const char* kFloorEntry = "0x0000";         // health 0: walkable
+
+struct Options {
+    bool quick{false};
+    int enemies{ENEMY_COUNT};
+    std::string output_path{kDefaultOutput};
+    std::filesystem::path work_dir;
+};
+
+struct Stats {
+    double p50{0.0};
+    double p99{0.0};
+    double mean{0.0};
+    double max{0.0};
+};
+
+struct CaseResult {
+    double density{0.0};
+    int destructible_cells{0};
+    int frames{0};
+    Stats frame_ms;
+    Stats draw_calls;
+    std::size_t steady_state_buffer_growths{0};
+};
+
+// Nearest-rank percentiles over a copy of `samples`.
+Stats summarize(std::vector<double> samples) {
+    Stats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const auto rank = [&samples](double percentile) {
+        const std::size_t index = static_cast<std::size_t>(percentile * samples.size());
+        return samples[std::min(index, samples.size() - 1)];
+    };
+    stats.p50 = rank(0.50);
+    stats.p99 = rank(0.99);
+    stats.max = samples.back();
+    double total = 0.0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    stats.mean = total / static_cast<double>(samples.size());
+    return stats;
+}
+
+// Border walls are indestructible; each interior cell is a destructible wall with probability
+// `density`. The player's start cell stays open. Returns the number of destructible cells.
+int write_map(const std::filesystem::path& path, double density) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return -1;
+    }
+
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<double> roll(0.0, 1.0);
+    const int player_row = GRID_HEIGHT - 2;
+    const int player_col = GRID_WIDTH / 2;
+    int destructible_cells = 0;
+    for (int row = 0; row < GRID_HEIGHT; ++row) {
+        for (int col = 0; col < GRID_WIDTH; ++col) {
+            const bool border =
+                row == 0 || col == 0 || row == GRID_HEIGHT - 1 || col == GRID_WIDTH - 1;
+            const bool destructible = !border && !(row == player_row && col == player_col) &&
+                                      roll(rng) < density;
+            const char* entry = border ? kBorderEntry : destructible ? kDestructibleEntry
+                                                                     : kFloorEntry;
+            destructible_cells += destructible ? 1 : 0;
+
+            out << (col == 0 ? "" : " ") << (border || destructible ? 1 : 0) << '|';
+            for (int i = 0; i < GameMap::kSubtilesPerCell; ++i) {
+                out << (i == 0 ? "" : ",") << entry;
+            }
+        }
+        out << '\n';
+    }
+    return out ? destructible_cells : -1;
+}
+
+// Sweeps the player around while firing, so walls get damaged and the renderer's static layer
+// is refreshed during the run as it would be in play.
+PlayerInput scripted_input(int frame) {
+    static const Character::Direction directions[] = {
+        Character::Direction::kUp, Character::Direction::kRight, Character::Direction::kDown,
+        Character::Direction::kLeft};
+    PlayerInput input;
+    input.direction = directions[(frame / kTurnInterval) % 4];
+    input.fire = frame % kFireInterval == 0;
+    return input;
+}
+
+bool run_case(SDLContext* context, const std::string& map_path, const Options& options,
+              CaseResult* result) {
+    std::shared_ptr<GameMap> map_ptr =
+        std::make_shared<GameMap>(GRID_HEIGHT, GRID_WIDTH, GRID_SIZE, map_path, 0);
+    if (!map_ptr->MatchesDimensions(GRID_HEIGHT, GRID_WIDTH)) {
+        std::cerr << "Error: Benchmark map '" << map_path << "' loaded as " << map_ptr->RowCount()
+                  << "x" << map_ptr->ColCount() << ".\n";
+        return false;
+    }
+    std::shared_ptr<AICentral> aiCentral =
+        std::make_shared<AICentral>(map_ptr->RowCount(), map_ptr->ColCount());
+
+    // Renderer owns GPU resources, so it must be destroyed before the SDL context.
+    Renderer renderer(GRID_SIZE, GRID_WIDTH, GRID_HEIGHT, map_ptr, context,
+                      resolve_game_config_path());
+    Game game(GRID_SIZE, GRID_WIDTH, GRID_HEIGHT, map_ptr, aiCentral, kSeed, options.enemies, 1);
+
+    result->frames = options.quick ? kQuickFrames : kFrames;
+    std::vector<double> frame_ms;
+    std::vector<double> draw_calls;
+    frame_ms.reserve(static_cast<std::size_t>(result->frames));
+    draw_calls.reserve(static_cast<std::size_t>(result->frames));
+    for (int frame = 0; frame < result->frames; ++frame) {
+        game.Update(scripted_input(frame));
+
+        const auto start = std::chrono::steady_clock::now();
+        renderer.Render(game.GetPlayer(), game.GetEnemies(), game.GetProjectiles(), kAlpha);
+        const auto end = std::chrono::steady_clock::now();
+        frame_ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        draw_calls.push_back(static_cast<double>(renderer.LastFrameDrawCalls()));
+    }
+
+    result->frame_ms = summarize(frame_ms);
+    result->draw_calls = summarize(draw_calls);
+    result->steady_state_buffer_growths = renderer.SteadyStateBufferGrowths();
+    return true;
+}
+
+void write_stats(std::ostream& out, const char* name, const Stats& stats) {
+    out << "\"" << name << "\": {\"p50\": " << stats.p50 << ", \"p99\": " << stats.p99
+        << ", \"mean\": " << stats.mean << ", \"max\": " << stats.max << "}";
+}
+
+bool write_results(const std::string& path, const SDLContext& context, const Options& options,
+                   const std::vector<CaseResult>& results) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    const char* video_driver = SDL_GetCurrentVideoDriver();
+    const char* render_driver = SDL_GetRendererName(context.renderer);
+    out << "{\n  \"benchmark\": \"bench_renderer\",\n  \"quick\": "
+        << (options.quick ? "true" : "false") << ",\n  \"video_driver\": \""
+        << (video_driver ? video_driver : "") << "\",\n  \"render_driver\": \""
+        << (render_driver ? render_driver : "") << "\",\n  \"grid\": [" << GRID_WIDTH << ", "
+        << GRID_HEIGHT << ", " << GRID_SIZE << "],\n  \"enemies\": " << options.enemies
+        << ",\n  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const CaseResult& result = results[i];
+        out << "    {\"density\": " << result.density
+            << ", \"destructible_cells\": " << result.destructible_cells
+            << ", \"frames\": " << result.frames << ",\n     ";
+        write_stats(out, "frame_ms", result.frame_ms);
+        out << ",\n     ";
+        write_stats(out, "draw_calls", result.draw_calls);
+        out << ",\n     \"steady_state_buffer_growths\": " << result.steady_state_buffer_growths
+            << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+// Accepts a whole non-negative decimal number that fits in an int.
+bool parse_count(const char* text, int* out_value) {
+    char* end = nullptr;
+    errno = 0;
+    const long value = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || value < 0 ||
+        value > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    *out_value = static_cast<int>(value);
+    return true;
+}
+
+bool parse_args(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--quick") {
+            options->quick = true;
+        } else if (arg == "--enemies" && i + 1 < argc) {
+            if (!parse_count(argv[++i], &options->enemies)) {
+                std::cerr << "Error: --enemies needs a non-negative number, got '" << argv[i]
+                          << "'.\n";
+                return false;
+            }
+        } else if (arg == "--output" && i + 1 < argc) {
+            options->output_path = argv[++i];
+        } else if (arg == "--dir" && i + 1 < argc) {
+            options->work_dir = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_usage() {
+    std::cout << "Usage: bench_renderer [--quick] [--enemies N] [--output PATH] [--dir PATH]\n"
+                 "  --quick        a few frames per map (smoke test)\n"
+                 "  --enemies N    enemies spawned on each map\n"
+                 "  --output PATH  JSON results file (default: bench_renderer.json)\n"
+                 "  --dir PATH     directory for the generated maps (default: temp dir)\n";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parse_args(argc, argv, &options)) {
+        print_usage();
+        return argc > 1 && std::string(argv[1]) == "--help" ? 0 : 1;
+    }
+
+    std::error_code error;
+    if (options.work_dir.empty()) {
+        options.work_dir = std::filesystem::temp_directory_path(error) / "bench_renderer";
+    }
+    std::filesystem::create_directories(options.work_dir, error);
+    if (error) {
+        std::cerr << "Error: Cannot create benchmark directory '" << options.work_dir.string()
+                  << "'.\n";
+        return 1;
+    }
+
+    // Offscreen defaults; SDL_VIDEODRIVER / SDL_RENDER_DRIVER in the environment take precedence.
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    SDLContext context;
+    SDLContextConfig config{};
+    config.title = "Renderer Benchmark";
+    config.width = GRID_WIDTH * GRID_SIZE;
+    config.height = GRID_HEIGHT * GRID_SIZE;
+    config.vsync = false;  // Present must not wait for a display refresh.
+    if (!sdl_init_context(&context, &config)) {
+        SDL_Quit();
+        return 1;
+    }
+
+    const double densities[] = {0.0, 0.1, 0.25, 0.5, 0.75};
+    std::vector<CaseResult> results;
+    bool ok = true;
+    for (double density : densities) {
+        const std::filesystem::path path =
+            options.work_dir / ("density_" + std::to_string(static_cast<int>(density * 100)) +
+                                ".map");
+        CaseResult result;
+        result.density = density;
+        result.destructible_cells = write_map(path, density);
+        if (result.destructible_cells < 0) {
+            std::cerr << "Error: Cannot write benchmark map '" << path.string() << "'.\n";
+            ok = false;
+            break;
+        }
+        ok = run_case(&context, path.string(), options, &result);
+        std::filesystem::remove(path, error);
+        if (!ok) {
+            break;
+        }
+
+        std::cout << "density " << density << ": p50 " << result.frame_ms.p50 << " ms, p99 "
+                  << result.frame_ms.p99 << " ms, draw calls p50 " << result.draw_calls.p50
+                  << " p99 " << result.draw_calls.p99 << "\n";
+        results.push_back(result);
+    }
+
+    if (ok && !write_results(options.output_path, context, options, results)) {
+        std::cerr << "Error: Cannot write '" << options.output_path << "'.\n";
+        ok = false;
+    }
+    if (ok) {
+        std::cout << "Results written to: " << options.output_path << "\n";
+    }
+
+    sdl_cleanup_context(&context);
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
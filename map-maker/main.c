@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../shared/map_db/map_db.h"
 #include "../shared/text_renderer/text_renderer.h"
 #include "../shared/ui_framework/ui_viewport.h"
 #include "../tile-maker/palette_io.h"
@@ -645,6 +646,166 @@ static bool metadata_read_header(FILE* file, MapMetadata* out_meta) {
     return true;
 }
 
+static void metadata_to_db(const MapMetadata* meta, MapDbMeta* out_meta) {
+    memset(out_meta, 0, sizeof(*out_meta));
+    out_meta->player_count = 2;
+    for (int i = 0; i < 2; ++i) {
+        out_meta->player_spawns[i].x = meta->player_spawns[i].x;
+        out_meta->player_spawns[i].y = meta->player_spawns[i].y;
+    }
+
+    const StructureRect* bases[2] = {&meta->player_base, &meta->enemy_base};
+    MapDbStructure* db_bases[2] = {&out_meta->home_bases[0], &out_meta->enemy_bases[0]};
+    for (int i = 0; i < 2; ++i) {
+        db_bases[i]->x = bases[i]->x;
+        db_bases[i]->y = bases[i]->y;
+        db_bases[i]->w = bases[i]->w;
+        db_bases[i]->h = bases[i]->h;
+        db_bases[i]->tile_x = bases[i]->tile_x;
+        db_bases[i]->tile_y = bases[i]->tile_y;
+    }
+    out_meta->home_base_count = meta->player_base.exists ? 1u : 0u;
+    out_meta->enemy_base_count = meta->enemy_base.exists ? 1u : 0u;
+
+    out_meta->enemy_spawn_count = 3;
+    for (int i = 0; i < 3; ++i) {
+        out_meta->enemy_spawns[i].x = meta->enemy_spawns[i].x;
+        out_meta->enemy_spawns[i].y = meta->enemy_spawns[i].y;
+    }
+    out_meta->initial_enemy_count = meta->enemy_count;
+    out_meta->max_alive_enemies = meta->enemy_count;
+    out_meta->factory_enabled = meta->enemy_base_produces_extra ? 1u : 0u;
+}
+
+static void metadata_from_db(const MapDbMeta* db_meta, MapMetadata* out_meta) {
+    for (int i = 0; i < 2; ++i) {
+        out_meta->player_spawns[i].x = db_meta->player_spawns[i].x;
+        out_meta->player_spawns[i].y = db_meta->player_spawns[i].y;
+    }
+    for (int i = 0; i < db_meta->enemy_spawn_count && i < 3; ++i) {
+        out_meta->enemy_spawns[i].x = db_meta->enemy_spawns[i].x;
+        out_meta->enemy_spawns[i].y = db_meta->enemy_spawns[i].y;
+    }
+
+    StructureRect* bases[2] = {&out_meta->player_base, &out_meta->enemy_base};
+    const MapDbStructure* db_bases[2] = {&db_meta->home_bases[0], &db_meta->enemy_bases[0]};
+    const uint8_t counts[2] = {db_meta->home_base_count, db_meta->enemy_base_count};
+    for (int i = 0; i < 2; ++i) {
+        bases[i]->exists = counts[i] > 0;
+        if (!bases[i]->exists) {
+            continue;
+        }
+        bases[i]->x = db_bases[i]->x;
+        bases[i]->y = db_bases[i]->y;
+        bases[i]->w = db_bases[i]->w;
+        bases[i]->h = db_bases[i]->h;
+        bases[i]->tile_x = db_bases[i]->tile_x;
+        bases[i]->tile_y = db_bases[i]->tile_y;
+    }
+    out_meta->enemy_count = db_meta->initial_enemy_count;
+    out_meta->enemy_base_produces_extra = db_meta->factory_enabled != 0;
+}
+
+// maps.db files hold several maps; the editor works on the first one and keeps the rest.
+static bool load_map_db_file(const char* path, MapMetadata* out_meta) {
+    MapDb db;
+    if (!map_db_open_file(&db, path)) {
+        return false;
+    }
+
+    MapDbMap* map = (MapDbMap*)malloc(sizeof(MapDbMap));
+    bool ok = map && map_db_read_map(&db, 0, map);
+    map_db_close(&db);
+    if (!ok) {
+        free(map);
+        return false;
+    }
+
+    for (int row = 0; row < MAP_ROWS; ++row) {
+        for (int col = 0; col < MAP_COLS; ++col) {
+            if (row >= map->height || col >= map->width) {
+                fill_cell(row, col, 1, 1, 1, 0);
+                g_map[row][col].material = 1;
+                continue;
+            }
+
+            const MapDbCell* cell = &map->cells[row * map->width + col];
+            if (cell->flags & MAP_DB_CELL_HAS_SUBTILES) {
+                memcpy(g_map[row][col].entries, cell->subtiles, sizeof(g_map[row][col].entries));
+                g_map[row][col].material = cell->material == 0 ? 0 : 1;
+            } else if (cell->material == 0) {
+                fill_cell(row, col, 0, 1, 0, 1);
+            } else {
+                fill_cell(row, col, 1, 1, 1, 0);
+                g_map[row][col].material = 1;
+            }
+        }
+    }
+
+    if (out_meta) {
+        metadata_init_defaults(out_meta);
+        out_meta->map_cols = map->width;
+        out_meta->map_rows = map->height;
+        if (map->has_meta) {
+            metadata_from_db(&map->meta, out_meta);
+        }
+        metadata_clamp(out_meta);
+    }
+    free(map);
+    return true;
+}
+
+static bool save_map_db_file(const char* path, const MapMetadata* meta) {
+    MapDb db;
+    const bool has_existing = map_db_open_file(&db, path);
+    const uint16_t map_count = (has_existing && db.map_count > 0) ? db.map_count : 1;
+
+    MapDbMap* maps = (MapDbMap*)calloc(map_count, sizeof(MapDbMap));
+    bool ok = maps != NULL;
+    for (uint16_t i = 1; ok && i < map_count; ++i) {
+        ok = map_db_read_map(&db, i, &maps[i]);
+    }
+    if (ok && has_existing && db.map_count > 0) {
+        MapDbEntry entry;
+        map_db_get_entry(&db, 0, &entry);
+        maps[0].map_no = entry.map_no;
+        memcpy(maps[0].title, entry.title, sizeof(maps[0].title));
+    }
+    if (has_existing) {
+        map_db_close(&db);
+    }
+    if (!ok) {
+        free(maps);
+        return false;
+    }
+
+    MapDbMap* map = &maps[0];
+    if (map->title[0] == '\0') {
+        strncpy(map->title, "map", MAP_DB_TITLE_SIZE);
+    }
+    map->width = meta->map_cols;
+    map->height = meta->map_rows;
+    map->has_meta = true;
+    metadata_to_db(meta, &map->meta);
+    for (int row = 0; row < map->height; ++row) {
+        for (int col = 0; col < map->width; ++col) {
+            MapDbCell* cell = &map->cells[row * map->width + col];
+            cell->material = g_map[row][col].material == 0 ? 0 : 1;
+            cell->flags = MAP_DB_CELL_HAS_SUBTILES;
+            memcpy(cell->subtiles, g_map[row][col].entries, sizeof(cell->subtiles));
+        }
+    }
+
+    ok = map_db_write_file(path, maps, map_count);
+    free(maps);
+    return ok;
+}
+
+static bool path_has_db_extension(const char* path) {
+    const size_t length = strlen(path);
+    return length >= 3 && strcmp(path + length - 3, ".db") == 0;
+}
+
 static bool load_map_file(const char* path, MapMetadata* out_meta) {
     if (!path) {
         return false;
@@ -662,6 +823,11 @@ static bool load_map_file(const char* path, MapMetadata* out_meta) {
         return false;
     }
 
+    if (map_db_has_magic(magic, sizeof(magic))) {
+        fclose(file);
+        return load_map_db_file(path, out_meta);
+    }
+
     bool has_header = magic[0] == 'M' && magic[1] == 'M' && magic[2] == 'D' && magic[3] == '1';
     bool ok = false;
     if (has_header) {
@@ -690,6 +856,9 @@ static bool save_map_file(const char* path, const MapMetadata* meta) {
     if (!path || !meta) {
         return false;
     }
+    if (path_has_db_extension(path)) {
+        return save_map_db_file(path, meta);
+    }
 
     FILE* file = fopen(path, "wb");
     if (!file) {
@@ -711,8 +880,8 @@ static bool path_equals(const char* a, const char* b) {
 
 static int collect_map_choices(const AppState* app, bool existing_only, char out_paths[][260],
                                bool out_exists[]) {
-    static const char* kPlaceholders[] = {"src/game.map", "src/map_a.map", "src/map_b.map",
-                                          "src/test.map", "src/dev.map"};
+    static const char* kPlaceholders[] = {"src/game.map", "src/maps.db", "src/map_a.map",
+                                          "src/map_b.map", "src/test.map", "src/dev.map"};
     int count = 0;
 
     if (!app) {
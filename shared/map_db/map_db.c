@@ -0,0 +1,648 @@
+#include "map_db.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../utilities/file_utils.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const uint8_t kContainerMagic[4] = {'M', 'A', 'P', 'D'};
+static const uint8_t kRecordMagic[4] = {'M', 'A', 'P', 'R'};
+
+// Half-byte CRC32 table (reflected polynomial 0xEDB88320): small enough to be a constant,
+// fast enough for map-sized records.
+static const uint32_t kCrcNibbleTable[16] = {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u,
+    0x4DB26158u, 0x5005713Cu, 0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu};
+
+static uint16_t read_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t read_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+static void write_u16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)(value & 0xFFu);
+    p[1] = (uint8_t)((value >> 8) & 0xFFu);
+}
+
+static void write_u32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)(value & 0xFFu);
+    p[1] = (uint8_t)((value >> 8) & 0xFFu);
+    p[2] = (uint8_t)((value >> 16) & 0xFFu);
+    p[3] = (uint8_t)((value >> 24) & 0xFFu);
+}
+
+static void read_title(const uint8_t* p, char* out_title) {
+    memcpy(out_title, p, MAP_DB_TITLE_SIZE);
+    out_title[MAP_DB_TITLE_SIZE] = '\0';
+
+    // Titles are null or space padded on disk.
+    size_t length = strlen(out_title);
+    while (length > 0 && out_title[length - 1] == ' ') {
+        out_title[--length] = '\0';
+    }
+}
+
+static size_t meta_encoded_size(const MapDbMeta* meta) {
+    return 1 + 1 + 2 * MAP_DB_MAX_PLAYER_SPAWNS + 1 + 6 * (size_t)meta->home_base_count + 1 +
+           6 * (size_t)meta->enemy_base_count + 1 + 2 * (size_t)meta->enemy_spawn_count + 1 + 1 +
+           1 + 2 + 2;
+}
+
+static size_t record_encoded_size(const MapDbMap* map) {
+    size_t size = MAP_DB_RECORD_HEADER_SIZE;
+    if (map->has_meta) {
+        size += MAP_DB_CHUNK_HEADER_SIZE + meta_encoded_size(&map->meta);
+    }
+    size += MAP_DB_CHUNK_HEADER_SIZE +
+            (size_t)map->width * (size_t)map->height * MAP_DB_GRID_CELL_SIZE;
+    if (map->tags_size > 0) {
+        size += MAP_DB_CHUNK_HEADER_SIZE + map->tags_size;
+    }
+    return size;
+}
+
+static uint8_t* write_structure(uint8_t* p, const MapDbStructure* structure) {
+    p[0] = structure->x;
+    p[1] = structure->y;
+    p[2] = structure->w;
+    p[3] = structure->h;
+    p[4] = structure->tile_x;
+    p[5] = structure->tile_y;
+    return p + 6;
+}
+
+static const uint8_t* read_structure(const uint8_t* p, MapDbStructure* out_structure) {
+    out_structure->x = p[0];
+    out_structure->y = p[1];
+    out_structure->w = p[2];
+    out_structure->h = p[3];
+    out_structure->tile_x = p[4];
+    out_structure->tile_y = p[5];
+    return p + 6;
+}
+
+static uint8_t* write_meta(uint8_t* p, const MapDbMeta* meta) {
+    *p++ = meta->mode;
+    *p++ = meta->player_count;
+    for (int i = 0; i < MAP_DB_MAX_PLAYER_SPAWNS; ++i) {
+        *p++ = meta->player_spawns[i].x;
+        *p++ = meta->player_spawns[i].y;
+    }
+    *p++ = meta->home_base_count;
+    for (int i = 0; i < meta->home_base_count; ++i) {
+        p = write_structure(p, &meta->home_bases[i]);
+    }
+    *p++ = meta->enemy_base_count;
+    for (int i = 0; i < meta->enemy_base_count; ++i) {
+        p = write_structure(p, &meta->enemy_bases[i]);
+    }
+    *p++ = meta->enemy_spawn_count;
+    for (int i = 0; i < meta->enemy_spawn_count; ++i) {
+        *p++ = meta->enemy_spawns[i].x;
+        *p++ = meta->enemy_spawns[i].y;
+    }
+    *p++ = meta->initial_enemy_count;
+    *p++ = meta->max_alive_enemies;
+    *p++ = meta->factory_enabled;
+    write_u16(p, meta->factory_spawn_interval_sec);
+    write_u16(p + 2, meta->factory_flags);
+    return p + 4;
+}
+
+static uint8_t* write_chunk_header(uint8_t* p, uint16_t chunk_id, size_t payload_size) {
+    write_u16(p, chunk_id);
+    write_u32(p + 2, (uint32_t)payload_size);
+    return p + MAP_DB_CHUNK_HEADER_SIZE;
+}
+
+static void write_record(uint8_t* p, const MapDbMap* map) {
+    const uint16_t chunk_count =
+        (uint16_t)(1 + (map->has_meta ? 1 : 0) + (map->tags_size > 0 ? 1 : 0));
+    memcpy(p, kRecordMagic, sizeof(kRecordMagic));
+    write_u16(p + 4, MAP_DB_RECORD_VERSION);
+    p[6] = map->width;
+    p[7] = map->height;
+    write_u16(p + 8, chunk_count);
+    p += MAP_DB_RECORD_HEADER_SIZE;
+
+    // GRID goes first so its payload inherits the record alignment (see map_db.h).
+    const size_t cell_count = (size_t)map->width * (size_t)map->height;
+    p = write_chunk_header(p, MAP_DB_CHUNK_GRID, cell_count * MAP_DB_GRID_CELL_SIZE);
+    for (size_t i = 0; i < cell_count; ++i) {
+        const MapDbCell* cell = &map->cells[i];
+        p[0] = cell->material;
+        p[1] = cell->flags;
+        for (int s = 0; s < MAP_DB_SUBTILES_PER_CELL; ++s) {
+            write_u16(p + 2 + 2 * s, cell->subtiles[s]);
+        }
+        p += MAP_DB_GRID_CELL_SIZE;
+    }
+
+    if (map->has_meta) {
+        p = write_chunk_header(p, MAP_DB_CHUNK_META, meta_encoded_size(&map->meta));
+        p = write_meta(p, &map->meta);
+    }
+
+    if (map->tags_size > 0) {
+        p = write_chunk_header(p, MAP_DB_CHUNK_TAGS, map->tags_size);
+        memcpy(p, map->tags, map->tags_size);
+    }
+}
+
+static size_t align_record_offset(size_t offset) {
+    return (offset + MAP_DB_RECORD_ALIGNMENT - 1) & ~(size_t)(MAP_DB_RECORD_ALIGNMENT - 1);
+}
+
+static bool map_is_encodable(const MapDbMap* map) {
+    if (map->width == 0 || map->width > MAP_DB_MAX_COLS || map->height == 0 ||
+        map->height > MAP_DB_MAX_ROWS) {
+        return false;
+    }
+    if (map->tags_size > MAP_DB_MAX_TAGS_SIZE) {
+        return false;
+    }
+    if (map->has_meta && (map->meta.home_base_count > MAP_DB_MAX_HOME_BASES ||
+                          map->meta.enemy_base_count > MAP_DB_MAX_ENEMY_BASES ||
+                          map->meta.enemy_spawn_count > MAP_DB_MAX_ENEMY_SPAWNS)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Compute the CRC32 (IEEE 802.3) of a buffer
+ */
+uint32_t map_db_crc32(const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= bytes[i];
+        crc = (crc >> 4) ^ kCrcNibbleTable[crc & 0x0Fu];
+        crc = (crc >> 4) ^ kCrcNibbleTable[crc & 0x0Fu];
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/**
+ * Check whether a buffer starts with the "MAPD" container magic
+ */
+bool map_db_has_magic(const void* data, size_t size) {
+    return data && size >= sizeof(kContainerMagic) &&
+           memcmp(data, kContainerMagic, sizeof(kContainerMagic)) == 0;
+}
+
+/**
+ * Open a database held in memory without copying it
+ */
+bool map_db_open_memory(MapDb* db, const void* data, size_t size) {
+    if (!db) {
+        return false;
+    }
+    memset(db, 0, sizeof(*db));
+    if (!map_db_has_magic(data, size) || size < MAP_DB_HEADER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* bytes = (const uint8_t*)data;
+    if (read_u16(bytes + 4) != MAP_DB_VERSION) {
+        return false;
+    }
+
+    const uint16_t map_count = read_u16(bytes + 6);
+    const uint32_t index_offset = read_u32(bytes + 8);
+    const size_t index_size = (size_t)map_count * MAP_DB_INDEX_ENTRY_SIZE;
+    if (index_offset < MAP_DB_HEADER_SIZE || index_offset > size ||
+        index_size > size - index_offset) {
+        return false;
+    }
+
+    db->data = bytes;
+    db->size = size;
+    db->map_count = map_count;
+    db->index_offset = index_offset;
+    return true;
+}
+
+/**
+ * Read a database file into memory and open it
+ */
+bool map_db_open_file(MapDb* db, const char* path) {
+    if (!db || !path) {
+        return false;
+    }
+    memset(db, 0, sizeof(*db));
+
+    size_t size = 0;
+    void* data = file_read_all(path, &size);
+    if (!data) {
+        return false;
+    }
+    if (!map_db_open_memory(db, data, size)) {
+        free(data);
+        return false;
+    }
+
+    db->owned_data = data;
+    return true;
+}
+
+/**
+ * Map a database file read-only and open it without reading it
+ */
+bool map_db_open_mapped(MapDb* db, const char* path) {
+    if (!db || !path) {
+        return false;
+    }
+    memset(db, 0, sizeof(*db));
+
+    size_t size = 0;
+    void* view = file_map_readonly(path, &size);
+    if (!view) {
+        return false;
+    }
+    if (!map_db_open_memory(db, view, size)) {
+        file_unmap(view, size);
+        return false;
+    }
+
+    db->mapped_data = view;
+    return true;
+}
+
+/**
+ * Release a database
+ */
+void map_db_close(MapDb* db) {
+    if (!db) {
+        return;
+    }
+    free(db->owned_data);
+    file_unmap(db->mapped_data, db->size);
+    memset(db, 0, sizeof(*db));
+}
+
+/**
+ * Read an index table entry in O(1)
+ */
+bool map_db_get_entry(const MapDb* db, uint16_t index, MapDbEntry* out_entry) {
+    if (!db || !db->data || !out_entry || index >= db->map_count) {
+        return false;
+    }
+
+    const uint8_t* p = db->data + db->index_offset + (size_t)index * MAP_DB_INDEX_ENTRY_SIZE;
+    out_entry->map_no = read_u16(p);
+    read_title(p + 2, out_entry->title);
+    out_entry->map_flags = read_u16(p + 18);
+    out_entry->record_offset = read_u32(p + 20);
+    out_entry->record_size = read_u32(p + 24);
+    out_entry->crc32 = read_u32(p + 28);
+    return true;
+}
+
+/**
+ * Find the index table position of a map number
+ */
+bool map_db_find_map(const MapDb* db, uint16_t map_no, uint16_t* out_index) {
+    if (!db || !db->data || !out_index) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < db->map_count; ++i) {
+        const uint8_t* p = db->data + db->index_offset + (size_t)i * MAP_DB_INDEX_ENTRY_SIZE;
+        if (read_u16(p) == map_no) {
+            *out_index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Validate a record and expose its chunks
+ */
+bool map_db_open_record(const MapDb* db, uint16_t index, MapDbRecord* out_record) {
+    MapDbEntry entry;
+    if (!out_record || !map_db_get_entry(db, index, &entry)) {
+        return false;
+    }
+    if (entry.record_offset > db->size || entry.record_size > db->size - entry.record_offset ||
+        entry.record_size < MAP_DB_RECORD_HEADER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* record = db->data + entry.record_offset;
+    if (map_db_crc32(record, entry.record_size) != entry.crc32) {
+        return false;
+    }
+    if (memcmp(record, kRecordMagic, sizeof(kRecordMagic)) != 0 ||
+        read_u16(record + 4) != MAP_DB_RECORD_VERSION) {
+        return false;
+    }
+
+    const uint8_t width = record[6];
+    const uint8_t height = record[7];
+    if (width == 0 || width > MAP_DB_MAX_COLS || height == 0 || height > MAP_DB_MAX_ROWS) {
+        return false;
+    }
+
+    // Walk the chunk framing once so later lookups can trust every chunk header.
+    const uint16_t chunk_count = read_u16(record + 8);
+    const uint32_t chunks_size = entry.record_size - MAP_DB_RECORD_HEADER_SIZE;
+    const uint8_t* chunks = record + MAP_DB_RECORD_HEADER_SIZE;
+    uint32_t offset = 0;
+    for (uint16_t i = 0; i < chunk_count; ++i) {
+        if (chunks_size - offset < MAP_DB_CHUNK_HEADER_SIZE) {
+            return false;
+        }
+        const uint32_t payload_size = read_u32(chunks + offset + 2);
+        offset += MAP_DB_CHUNK_HEADER_SIZE;
+        if (payload_size > chunks_size - offset) {
+            return false;
+        }
+        offset += payload_size;
+    }
+
+    out_record->width = width;
+    out_record->height = height;
+    out_record->chunk_count = chunk_count;
+    out_record->chunks = chunks;
+    out_record->chunks_size = offset;
+    return true;
+}
+
+/**
+ * Locate a chunk in a validated record
+ */
+bool map_db_find_chunk(const MapDbRecord* record, uint16_t chunk_id, const uint8_t** out_payload,
+                       uint32_t* out_size) {
+    if (!record || !record->chunks || !out_payload || !out_size) {
+        return false;
+    }
+
+    uint32_t offset = 0;
+    for (uint16_t i = 0; i < record->chunk_count; ++i) {
+        const uint8_t* header = record->chunks + offset;
+        const uint32_t payload_size = read_u32(header + 2);
+        if (read_u16(header) == chunk_id) {
+            *out_payload = header + MAP_DB_CHUNK_HEADER_SIZE;
+            *out_size = payload_size;
+            return true;
+        }
+        offset += MAP_DB_CHUNK_HEADER_SIZE + payload_size;
+    }
+    return false;
+}
+
+/**
+ * Decode one cell of a GRID chunk payload
+ */
+void map_db_read_grid_cell(const uint8_t* grid, size_t cell_index, MapDbCell* out_cell) {
+    const uint8_t* p = grid + cell_index * MAP_DB_GRID_CELL_SIZE;
+    out_cell->material = p[0];
+    out_cell->flags = p[1];
+    for (int s = 0; s < MAP_DB_SUBTILES_PER_CELL; ++s) {
+        out_cell->subtiles[s] = read_u16(p + 2 + 2 * s);
+    }
+}
+
+/**
+ * Decode the META chunk of a validated record
+ */
+bool map_db_read_meta(const MapDbRecord* record, MapDbMeta* out_meta) {
+    const uint8_t* p = NULL;
+    uint32_t size = 0;
+    if (!out_meta || !map_db_find_chunk(record, MAP_DB_CHUNK_META, &p, &size)) {
+        return false;
+    }
+    const uint8_t* end = p + size;
+
+    MapDbMeta meta;
+    memset(&meta, 0, sizeof(meta));
+    if (end - p < 3 + 2 * MAP_DB_MAX_PLAYER_SPAWNS) {
+        return false;
+    }
+    meta.mode = *p++;
+    meta.player_count = *p++;
+    for (int i = 0; i < MAP_DB_MAX_PLAYER_SPAWNS; ++i) {
+        meta.player_spawns[i].x = *p++;
+        meta.player_spawns[i].y = *p++;
+    }
+
+    meta.home_base_count = *p++;
+    if (meta.home_base_count > MAP_DB_MAX_HOME_BASES || end - p < 6 * meta.home_base_count + 1) {
+        return false;
+    }
+    for (int i = 0; i < meta.home_base_count; ++i) {
+        p = read_structure(p, &meta.home_bases[i]);
+    }
+
+    meta.enemy_base_count = *p++;
+    if (meta.enemy_base_count > MAP_DB_MAX_ENEMY_BASES || end - p < 6 * meta.enemy_base_count + 1) {
+        return false;
+    }
+    for (int i = 0; i < meta.enemy_base_count; ++i) {
+        p = read_structure(p, &meta.enemy_bases[i]);
+    }
+
+    meta.enemy_spawn_count = *p++;
+    if (meta.enemy_spawn_count > MAP_DB_MAX_ENEMY_SPAWNS ||
+        end - p < 2 * meta.enemy_spawn_count + 7) {
+        return false;
+    }
+    for (int i = 0; i < meta.enemy_spawn_count; ++i) {
+        meta.enemy_spawns[i].x = *p++;
+        meta.enemy_spawns[i].y = *p++;
+    }
+
+    meta.initial_enemy_count = *p++;
+    meta.max_alive_enemies = *p++;
+    meta.factory_enabled = *p++;
+    meta.factory_spawn_interval_sec = read_u16(p);
+    meta.factory_flags = read_u16(p + 2);
+
+    *out_meta = meta;
+    return true;
+}
+
+/**
+ * Decode a whole map
+ */
+bool map_db_read_map(const MapDb* db, uint16_t index, MapDbMap* out_map) {
+    MapDbEntry entry;
+    MapDbRecord record;
+    if (!out_map || !map_db_get_entry(db, index, &entry) ||
+        !map_db_open_record(db, index, &record)) {
+        return false;
+    }
+
+    const uint8_t* grid = NULL;
+    uint32_t grid_size = 0;
+    const size_t cell_count = (size_t)record.width * (size_t)record.height;
+    if (!map_db_find_chunk(&record, MAP_DB_CHUNK_GRID, &grid, &grid_size) ||
+        grid_size != cell_count * MAP_DB_GRID_CELL_SIZE) {
+        return false;
+    }
+
+    memset(out_map, 0, sizeof(*out_map));
+    out_map->map_no = entry.map_no;
+    memcpy(out_map->title, entry.title, sizeof(out_map->title));
+    out_map->width = record.width;
+    out_map->height = record.height;
+    for (size_t i = 0; i < cell_count; ++i) {
+        map_db_read_grid_cell(grid, i, &out_map->cells[i]);
+    }
+
+    const uint8_t* meta_payload = NULL;
+    uint32_t meta_size = 0;
+    if (map_db_find_chunk(&record, MAP_DB_CHUNK_META, &meta_payload, &meta_size)) {
+        if (!map_db_read_meta(&record, &out_map->meta)) {
+            return false;
+        }
+        out_map->has_meta = true;
+    }
+
+    const uint8_t* tags = NULL;
+    uint32_t tags_size = 0;
+    if (map_db_find_chunk(&record, MAP_DB_CHUNK_TAGS, &tags, &tags_size)) {
+        // Tags are optional; keep what fits rather than rejecting the map.
+        out_map->tags_size =
+            (uint16_t)(tags_size > MAP_DB_MAX_TAGS_SIZE ? MAP_DB_MAX_TAGS_SIZE : tags_size);
+        memcpy(out_map->tags, tags, out_map->tags_size);
+    }
+    return true;
+}
+
+/**
+ * Encode maps into a database image
+ */
+uint8_t* map_db_encode(const MapDbMap* maps, uint16_t map_count, size_t* out_size) {
+    if ((!maps && map_count > 0) || !out_size) {
+        return NULL;
+    }
+
+    const size_t index_size = (size_t)map_count * MAP_DB_INDEX_ENTRY_SIZE;
+    size_t total_size = MAP_DB_HEADER_SIZE + index_size;
+    for (uint16_t i = 0; i < map_count; ++i) {
+        if (!map_is_encodable(&maps[i])) {
+            return NULL;
+        }
+        total_size = align_record_offset(total_size) + record_encoded_size(&maps[i]);
+    }
+    if (total_size > UINT32_MAX) {
+        return NULL;
+    }
+
+    uint8_t* buffer = (uint8_t*)calloc(1, total_size);
+    if (!buffer) {
+        return NULL;
+    }
+
+    memcpy(buffer, kContainerMagic, sizeof(kContainerMagic));
+    write_u16(buffer + 4, MAP_DB_VERSION);
+    write_u16(buffer + 6, map_count);
+    write_u32(buffer + 8, MAP_DB_HEADER_SIZE);
+    write_u32(buffer + 12, 0);
+
+    // Records follow the index table in index order, zero-padded to the record alignment.
+    size_t record_offset = MAP_DB_HEADER_SIZE + index_size;
+    for (uint16_t i = 0; i < map_count; ++i) {
+        const MapDbMap* map = &maps[i];
+        const size_t record_size = record_encoded_size(map);
+        record_offset = align_record_offset(record_offset);
+        uint8_t* record = buffer + record_offset;
+        write_record(record, map);
+
+        uint8_t* entry = buffer + MAP_DB_HEADER_SIZE + (size_t)i * MAP_DB_INDEX_ENTRY_SIZE;
+        write_u16(entry, map->map_no);
+        for (int c = 0; c < MAP_DB_TITLE_SIZE && map->title[c] != '\0'; ++c) {
+            entry[2 + c] = (uint8_t)map->title[c];
+        }
+        write_u16(entry + 18, 0);
+        write_u32(entry + 20, (uint32_t)record_offset);
+        write_u32(entry + 24, (uint32_t)record_size);
+        write_u32(entry + 28, map_db_crc32(record, record_size));
+        record_offset += record_size;
+    }
+
+    *out_size = total_size;
+    return buffer;
+}
+
+// Writes `data` to a sibling temporary file and renames it over `path`. The rename swaps the
+// directory entry, so readers holding the old file mapped keep their pages (the old inode)
+// instead of seeing it truncated and rewritten underneath them. The temporary file lives in
+// the target's directory because a rename cannot cross filesystems.
+static bool replace_file_contents(const char* path, const uint8_t* data, size_t size) {
+    const size_t temp_capacity = strlen(path) + 32;
+    char* temp_path = (char*)malloc(temp_capacity);
+    if (!temp_path) {
+        return false;
+    }
+
+    bool success = false;
+#ifdef _WIN32
+    snprintf(temp_path, temp_capacity, "%s.%lu.tmp", path, (unsigned long)GetCurrentProcessId());
+    FILE* file = fopen(temp_path, "wb");
+    if (file) {
+        success = (fwrite(data, 1, size, file) == size);
+        success = (fclose(file) == 0) && success;
+        success = success && MoveFileExA(temp_path, path, MOVEFILE_REPLACE_EXISTING) != 0;
+    }
+#else
+    snprintf(temp_path, temp_capacity, "%s.%ld.tmp", path, (long)getpid());
+    // Keep the permissions of the file being replaced.
+    struct stat st;
+    const mode_t mode = (stat(path, &st) == 0) ? (st.st_mode & 0777) : 0666;
+    const int fd = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    if (fd >= 0) {
+        size_t written = 0;
+        while (written < size) {
+            const ssize_t result = write(fd, data + written, size - written);
+            if (result <= 0) {
+                break;
+            }
+            written += (size_t)result;
+        }
+        success = (written == size);
+        success = (close(fd) == 0) && success;
+        success = success && rename(temp_path, path) == 0;
+    }
+#endif
+
+    if (!success) {
+        remove(temp_path);
+    }
+    free(temp_path);
+    return success;
+}
+
+/**
+ * Encode maps and write them to a file
+ */
+bool map_db_write_file(const char* path, const MapDbMap* maps, uint16_t map_count) {
+    if (!path) {
+        return false;
+    }
+
+    size_t size = 0;
+    uint8_t* buffer = map_db_encode(maps, map_count, &size);
+    if (!buffer) {
+        return false;
+    }
+
+    const bool success = replace_file_contents(path, buffer, size);
+    free(buffer);
+    return success;
+}
@@ -0,0 +1,303 @@
+#ifndef MAP_DB_H
+#define MAP_DB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Map Database (maps.db) for Shared Component Library
+ *
+ * Reads and writes the binary multi-map container described in docs/map_db_format.md
+ * (Option B): a "MAPD" header, an index table with one entry per map, and per-map "MAPR"
+ * records made of TLV chunks. Every record carries a CRC32 in its index entry.
+ *
+ * Opening a database only validates the header and index, so any map can be reached by index
+ * in O(1). Unknown chunks are skipped, which lets newer tools add chunks without breaking
+ * older readers. All multi-byte values are little-endian.
+ *
+ * The writer puts GRID first in every record and starts records on 4-byte boundaries, so on
+ * little-endian hosts a memory-mapped GRID payload can be read as uint16_t entries in place.
+ */
+
+#define MAP_DB_VERSION 1
+#define MAP_DB_RECORD_VERSION 1
+#define MAP_DB_HEADER_SIZE 16
+#define MAP_DB_INDEX_ENTRY_SIZE 32
+#define MAP_DB_RECORD_HEADER_SIZE 10
+#define MAP_DB_CHUNK_HEADER_SIZE 6
+#define MAP_DB_GRID_CELL_SIZE 34
+#define MAP_DB_RECORD_ALIGNMENT 4
+
+#define MAP_DB_TITLE_SIZE 16
+#define MAP_DB_MAX_COLS 32
+#define MAP_DB_MAX_ROWS 20
+#define MAP_DB_SUBTILES_PER_CELL 16
+#define MAP_DB_MAX_PLAYER_SPAWNS 2
+#define MAP_DB_MAX_HOME_BASES 1
+#define MAP_DB_MAX_ENEMY_BASES 1
+#define MAP_DB_MAX_ENEMY_SPAWNS 3
+#define MAP_DB_MAX_TAGS_SIZE 64
+
+#define MAP_DB_CHUNK_META 0x0001
+#define MAP_DB_CHUNK_GRID 0x0002
+#define MAP_DB_CHUNK_TAGS 0x0003
+
+/** GRID cell flag: the cell's subtile entries are meaningful (packed-token cells). */
+#define MAP_DB_CELL_HAS_SUBTILES 0x01
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+} MapDbPoint;
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+    uint8_t tile_x;
+    uint8_t tile_y;
+} MapDbStructure;
+
+/**
+ * Contents of the META chunk
+ */
+typedef struct {
+    uint8_t mode;  // 0 = normal, 1 = battle
+    uint8_t player_count;
+    MapDbPoint player_spawns[MAP_DB_MAX_PLAYER_SPAWNS];
+    uint8_t home_base_count;
+    MapDbStructure home_bases[MAP_DB_MAX_HOME_BASES];
+    uint8_t enemy_base_count;
+    MapDbStructure enemy_bases[MAP_DB_MAX_ENEMY_BASES];
+    uint8_t enemy_spawn_count;
+    MapDbPoint enemy_spawns[MAP_DB_MAX_ENEMY_SPAWNS];
+    uint8_t initial_enemy_count;
+    uint8_t max_alive_enemies;
+    uint8_t factory_enabled;
+    uint16_t factory_spawn_interval_sec;
+    uint16_t factory_flags;
+} MapDbMeta;
+
+/**
+ * One GRID cell
+ */
+typedef struct {
+    uint8_t material;  // 0 = floor, 1 = blocked
+    uint8_t flags;     // MAP_DB_CELL_* bits
+    uint16_t subtiles[MAP_DB_SUBTILES_PER_CELL];
+} MapDbCell;
+
+/**
+ * A fully decoded map, as produced by map_db_read_map() and consumed by the writer
+ */
+typedef struct {
+    uint16_t map_no;
+    char title[MAP_DB_TITLE_SIZE + 1];
+    uint8_t width;
+    uint8_t height;
+    bool has_meta;
+    MapDbMeta meta;
+    uint16_t tags_size;
+    uint8_t tags[MAP_DB_MAX_TAGS_SIZE];
+    MapDbCell cells[MAP_DB_MAX_ROWS * MAP_DB_MAX_COLS];  // row-major, `width` cells per row
+} MapDbMap;
+
+/**
+ * An open database. The data is borrowed (map_db_open_memory), owned (map_db_open_file) or
+ * memory-mapped (map_db_open_mapped) and must stay valid while records are in use.
+ */
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    uint16_t map_count;
+    uint32_t index_offset;
+    void* owned_data;
+    void* mapped_data;
+} MapDb;
+
+/**
+ * Index table entry
+ */
+typedef struct {
+    uint16_t map_no;
+    char title[MAP_DB_TITLE_SIZE + 1];
+    uint16_t map_flags;
+    uint32_t record_offset;
+    uint32_t record_size;
+    uint32_t crc32;
+} MapDbEntry;
+
+/**
+ * A validated record; chunk payloads point into the database data
+ */
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint16_t chunk_count;
+    const uint8_t* chunks;
+    uint32_t chunks_size;
+} MapDbRecord;
+
+/**
+ * Compute the CRC32 (IEEE 802.3) of a buffer
+ *
+ * @param data Bytes to checksum
+ * @param size Number of bytes
+ * @return CRC32 value
+ */
+uint32_t map_db_crc32(const void* data, size_t size);
+
+/**
+ * Open a database held in memory without copying it
+ * Validates the container header and that the index table lies within the buffer.
+ *
+ * @param db Database to initialize
+ * @param data Database bytes; must outlive the database
+ * @param size Size of data in bytes
+ * @return true if the header and index are valid
+ */
+bool map_db_open_memory(MapDb* db, const void* data, size_t size);
+
+/**
+ * Read a database file into memory and open it
+ *
+ * @param db Database to initialize; release with map_db_close()
+ * @param path Path to the maps.db file
+ * @return true if the file was read and its header and index are valid
+ */
+bool map_db_open_file(MapDb* db, const char* path);
+
+/**
+ * Map a database file read-only and open it without reading it
+ * Only the pages that are touched are loaded, and they are shared with every other process
+ * mapping the same file.
+ *
+ * @param db Database to initialize; release with map_db_close()
+ * @param path Path to the maps.db file
+ * @return true if the file was mapped and its header and index are valid
+ */
+bool map_db_open_mapped(MapDb* db, const char* path);
+
+/**
+ * Release a database opened with any of the map_db_open_* functions
+ *
+ * @param db Database to close
+ */
+void map_db_close(MapDb* db);
+
+/**
+ * Check whether a buffer starts with the "MAPD" container magic
+ *
+ * @param data Bytes to check
+ * @param size Size of data in bytes
+ * @return true if the magic matches
+ */
+bool map_db_has_magic(const void* data, size_t size);
+
+/**
+ * Read an index table entry in O(1)
+ *
+ * @param db Open database
+ * @param index Entry index, 0 to map_count - 1
+ * @param out_entry Output: decoded entry
+ * @return true if the index is in range
+ */
+bool map_db_get_entry(const MapDb* db, uint16_t index, MapDbEntry* out_entry);
+
+/**
+ * Find the index table position of a map number
+ *
+ * @param db Open database
+ * @param map_no Map number to look for
+ * @param out_index Output: entry index
+ * @return true if the map number is present
+ */
+bool map_db_find_map(const MapDb* db, uint16_t map_no, uint16_t* out_index);
+
+/**
+ * Validate a record and expose its chunks
+ * Checks the record bounds, CRC32, magic, version, dimensions and chunk framing.
+ *
+ * @param db Open database
+ * @param index Entry index
+ * @param out_record Output: validated record
+ * @return true if the record is intact
+ */
+bool map_db_open_record(const MapDb* db, uint16_t index, MapDbRecord* out_record);
+
+/**
+ * Locate a chunk in a validated record
+ *
+ * @param record Record from map_db_open_record()
+ * @param chunk_id Chunk identifier (MAP_DB_CHUNK_*)
+ * @param out_payload Output: pointer to the chunk payload
+ * @param out_size Output: payload size in bytes
+ * @return true if the chunk is present
+ */
+bool map_db_find_chunk(const MapDbRecord* record, uint16_t chunk_id, const uint8_t** out_payload,
+                       uint32_t* out_size);
+
+/**
+ * Decode one cell of a GRID chunk payload
+ *
+ * @param grid GRID payload from map_db_find_chunk()
+ * @param cell_index Row-major cell index; the caller checks it against width * height
+ * @param out_cell Output: decoded cell
+ */
+void map_db_read_grid_cell(const uint8_t* grid, size_t cell_index, MapDbCell* out_cell);
+
+/**
+ * Decode the META chunk of a validated record
+ *
+ * @param record Record from map_db_open_record()
+ * @param out_meta Output: decoded metadata
+ * @return true if the chunk is present and well-formed
+ */
+bool map_db_read_meta(const MapDbRecord* record, MapDbMeta* out_meta);
+
+/**
+ * Decode a whole map: index entry, META, GRID and TAGS
+ *
+ * @param db Open database
+ * @param index Entry index
+ * @param out_map Output: decoded map
+ * @return true if the record is intact and has a GRID chunk
+ */
+bool map_db_read_map(const MapDb* db, uint16_t index, MapDbMap* out_map);
+
+/**
+ * Encode maps into a database image
+ * Caller is responsible for freeing returned buffer
+ *
+ * @param maps Maps to store, in index order
+ * @param map_count Number of maps
+ * @param out_size Output: size of the image in bytes
+ * @return Pointer to allocated buffer containing the database, NULL on error
+ */
+uint8_t* map_db_encode(const MapDbMap* maps, uint16_t map_count, size_t* out_size);
+
+/**
+ * Encode maps and write them to a file
+ *
+ * The database is written to a temporary file next to `path` and renamed over it, so an
+ * existing database is replaced in one step: a reader that has it open through
+ * map_db_open_mapped() keeps reading the old contents until it closes and reopens.
+ *
+ * @param path Target file path
+ * @param maps Maps to store, in index order
+ * @param map_count Number of maps
+ * @return true if successful, false on error
+ */
+bool map_db_write_file(const char* path, const MapDbMap* maps, uint16_t map_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MAP_DB_H
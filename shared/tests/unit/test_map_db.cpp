@@ -0,0 +1,311 @@
+/**
+ * Unit Tests for Map Database Component
+ *
+ * Tests maps.db encoding, indexed access, chunk handling and corruption detection.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "map_db/map_db.h"
+
+namespace {
+// Builds a map whose cells are distinguishable by position.
+std::unique_ptr<MapDbMap> make_map(uint16_t map_no, const char* title, uint8_t width,
+                                   uint8_t height) {
+    auto map = std::make_unique<MapDbMap>();
+    map->map_no = map_no;
+    std::strncpy(map->title, title, MAP_DB_TITLE_SIZE);
+    map->width = width;
+    map->height = height;
+    for (int i = 0; i < width * height; ++i) {
+        MapDbCell& cell = map->cells[i];
+        cell.material = static_cast<uint8_t>(i % 2);
+        cell.flags = (i % 3 == 0) ? MAP_DB_CELL_HAS_SUBTILES : 0;
+        for (int s = 0; s < MAP_DB_SUBTILES_PER_CELL; ++s) {
+            cell.subtiles[s] = static_cast<uint16_t>(map_no * 1000 + i * 16 + s);
+        }
+    }
+    return map;
+}
+
+std::vector<uint8_t> encode(const std::vector<MapDbMap>& maps) {
+    size_t size = 0;
+    uint8_t* data = map_db_encode(maps.data(), static_cast<uint16_t>(maps.size()), &size);
+    std::vector<uint8_t> bytes;
+    if (data) {
+        bytes.assign(data, data + size);
+        free(data);
+    }
+    return bytes;
+}
+
+uint32_t read_u32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void write_u32(uint8_t* p, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>((value >> (8 * i)) & 0xFFu);
+    }
+}
+}  // namespace
+
+// ===== Checksum Tests =====
+
+TEST(MapDbTest, Crc32MatchesReferenceValue) {
+    EXPECT_EQ(map_db_crc32("123456789", 9), 0xCBF43926u);
+    EXPECT_EQ(map_db_crc32("", 0), 0u);
+}
+
+// ===== Round Trip Tests =====
+
+TEST(MapDbTest, EncodedMapsReadBackByIndex) {
+    std::vector<MapDbMap> maps(3);
+    maps[0] = *make_map(7, "first", 32, 20);
+    maps[1] = *make_map(3, "second map title", 5, 4);
+    maps[2] = *make_map(9, "third", 1, 1);
+    maps[1].has_meta = true;
+    maps[1].meta.mode = 1;
+    maps[1].meta.player_count = 2;
+    maps[1].meta.player_spawns[1] = MapDbPoint{4, 3};
+    maps[1].meta.home_base_count = 1;
+    maps[1].meta.home_bases[0] = MapDbStructure{1, 2, 3, 2, 5, 6};
+    maps[1].meta.enemy_spawn_count = 3;
+    maps[1].meta.enemy_spawns[2] = MapDbPoint{2, 1};
+    maps[1].meta.initial_enemy_count = 8;
+    maps[1].meta.factory_spawn_interval_sec = 300;
+    maps[2].tags_size = 4;
+    std::memcpy(maps[2].tags, "ctf", 4);
+
+    const std::vector<uint8_t> bytes = encode(maps);
+    ASSERT_FALSE(bytes.empty());
+
+    MapDb db;
+    ASSERT_TRUE(map_db_open_memory(&db, bytes.data(), bytes.size()));
+    EXPECT_EQ(db.map_count, 3);
+
+    MapDbEntry entry;
+    ASSERT_TRUE(map_db_get_entry(&db, 1, &entry));
+    EXPECT_EQ(entry.map_no, 3);
+    EXPECT_STREQ(entry.title, "second map title");
+    EXPECT_FALSE(map_db_get_entry(&db, 3, &entry));
+
+    uint16_t index = 0;
+    ASSERT_TRUE(map_db_find_map(&db, 9, &index));
+    EXPECT_EQ(index, 2);
+    EXPECT_FALSE(map_db_find_map(&db, 42, &index));
+
+    auto loaded = std::make_unique<MapDbMap>();
+    for (uint16_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(map_db_read_map(&db, i, loaded.get()));
+        EXPECT_EQ(loaded->map_no, maps[i].map_no);
+        EXPECT_STREQ(loaded->title, maps[i].title);
+        ASSERT_EQ(loaded->width, maps[i].width);
+        ASSERT_EQ(loaded->height, maps[i].height);
+        EXPECT_EQ(loaded->has_meta, maps[i].has_meta);
+        EXPECT_EQ(loaded->tags_size, maps[i].tags_size);
+        const int cell_count = loaded->width * loaded->height;
+        EXPECT_EQ(std::memcmp(loaded->cells, maps[i].cells, sizeof(MapDbCell) * cell_count), 0);
+    }
+
+    ASSERT_TRUE(map_db_read_map(&db, 1, loaded.get()));
+    EXPECT_EQ(loaded->meta.mode, 1);
+    EXPECT_EQ(loaded->meta.player_spawns[1].x, 4);
+    EXPECT_EQ(loaded->meta.home_base_count, 1);
+    EXPECT_EQ(loaded->meta.home_bases[0].tile_y, 6);
+    EXPECT_EQ(loaded->meta.enemy_spawn_count, 3);
+    EXPECT_EQ(loaded->meta.enemy_spawns[2].x, 2);
+    EXPECT_EQ(loaded->meta.factory_spawn_interval_sec, 300);
+
+    ASSERT_TRUE(map_db_read_map(&db, 2, loaded.get()));
+    EXPECT_STREQ(reinterpret_cast<const char*>(loaded->tags), "ctf");
+    map_db_close(&db);
+}
+
+TEST(MapDbTest, FileRoundTrip) {
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "shared_components_test_maps.db";
+    auto map = make_map(1, "file", 32, 20);
+    ASSERT_TRUE(map_db_write_file(path.string().c_str(), map.get(), 1));
+
+    MapDb db;
+    ASSERT_TRUE(map_db_open_file(&db, path.string().c_str()));
+    MapDbRecord record;
+    ASSERT_TRUE(map_db_open_record(&db, 0, &record));
+    EXPECT_EQ(record.width, 32);
+    EXPECT_EQ(record.height, 20);
+
+    const uint8_t* grid = nullptr;
+    uint32_t grid_size = 0;
+    ASSERT_TRUE(map_db_find_chunk(&record, MAP_DB_CHUNK_GRID, &grid, &grid_size));
+    EXPECT_EQ(grid_size, 32u * 20u * MAP_DB_GRID_CELL_SIZE);
+    MapDbCell cell;
+    map_db_read_grid_cell(grid, 21, &cell);
+    EXPECT_EQ(std::memcmp(&cell, &map->cells[21], sizeof(cell)), 0);
+
+    map_db_close(&db);
+    std::filesystem::remove(path);
+}
+
+TEST(MapDbTest, MappedFileKeepsGridAligned) {
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "shared_components_test_mapped.db";
+    std::vector<MapDbMap> maps(3);
+    for (uint16_t i = 0; i < 3; ++i) {
+        maps[i] = *make_map(i, "mapped", static_cast<uint8_t>(3 + i), 2);
+        // META has an odd size; records after it must still start aligned.
+        maps[i].has_meta = true;
+        maps[i].tags_size = 1;
+    }
+    ASSERT_TRUE(map_db_write_file(path.string().c_str(), maps.data(), 3));
+
+    MapDb db;
+    ASSERT_TRUE(map_db_open_mapped(&db, path.string().c_str()));
+    EXPECT_NE(db.mapped_data, nullptr);
+    for (uint16_t i = 0; i < 3; ++i) {
+        MapDbEntry entry;
+        ASSERT_TRUE(map_db_get_entry(&db, i, &entry));
+        EXPECT_EQ(entry.record_offset % MAP_DB_RECORD_ALIGNMENT, 0u);
+
+        MapDbRecord record;
+        const uint8_t* grid = nullptr;
+        uint32_t grid_size = 0;
+        ASSERT_TRUE(map_db_open_record(&db, i, &record));
+        ASSERT_TRUE(map_db_find_chunk(&record, MAP_DB_CHUNK_GRID, &grid, &grid_size));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(grid) % alignof(uint16_t), 0u);
+
+        MapDbCell cell;
+        map_db_read_grid_cell(grid, 1, &cell);
+        EXPECT_EQ(std::memcmp(&cell, &maps[i].cells[1], sizeof(cell)), 0);
+    }
+
+    map_db_close(&db);
+    EXPECT_EQ(db.mapped_data, nullptr);
+    std::filesystem::remove(path);
+}
+
+TEST(MapDbTest, RewriteWhileMappedKeepsOldContents) {
+    const std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "shared_components_test_rewrite";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path path = dir / "maps.db";
+    std::vector<MapDbMap> old_maps(3);
+    for (uint16_t i = 0; i < 3; ++i) {
+        old_maps[i] = *make_map(i, "old", 32, 20);
+    }
+    ASSERT_TRUE(map_db_write_file(path.string().c_str(), old_maps.data(), 3));
+
+    MapDb mapped;
+    ASSERT_TRUE(map_db_open_mapped(&mapped, path.string().c_str()));
+
+    // A smaller replacement: rewriting in place would truncate the pages still mapped above.
+    auto new_map = make_map(7, "new", 4, 4);
+    const bool replaced = map_db_write_file(path.string().c_str(), new_map.get(), 1);
+#ifdef _WIN32
+    // Windows refuses to replace a file that is still mapped; the old database must survive.
+    EXPECT_FALSE(replaced);
+#else
+    EXPECT_TRUE(replaced);
+#endif
+
+    ASSERT_EQ(mapped.map_count, 3);
+    for (uint16_t i = 0; i < 3; ++i) {
+        MapDbRecord record;
+        const uint8_t* grid = nullptr;
+        uint32_t grid_size = 0;
+        ASSERT_TRUE(map_db_open_record(&mapped, i, &record));
+        ASSERT_TRUE(map_db_find_chunk(&record, MAP_DB_CHUNK_GRID, &grid, &grid_size));
+        MapDbCell cell;
+        map_db_read_grid_cell(grid, 639, &cell);
+        EXPECT_EQ(std::memcmp(&cell, &old_maps[i].cells[639], sizeof(cell)), 0);
+    }
+    map_db_close(&mapped);
+
+    MapDb reopened;
+    ASSERT_TRUE(map_db_open_mapped(&reopened, path.string().c_str()));
+    EXPECT_EQ(reopened.map_count, replaced ? 1 : 3);
+    map_db_close(&reopened);
+
+    // Only the database itself is left behind, no temporary file.
+    int files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        EXPECT_EQ(entry.path().filename(), "maps.db");
+        ++files;
+    }
+    EXPECT_EQ(files, 1);
+    std::filesystem::remove_all(dir);
+}
+
+// ===== Robustness Tests =====
+
+TEST(MapDbTest, UnknownChunksAreSkipped) {
+    std::vector<MapDbMap> maps(1);
+    maps[0] = *make_map(1, "unknown", 2, 2);
+    std::vector<uint8_t> bytes = encode(maps);
+    ASSERT_FALSE(bytes.empty());
+
+    // Splice a chunk with an unassigned id in front of GRID and fix up the framing.
+    const size_t record_offset = MAP_DB_HEADER_SIZE + MAP_DB_INDEX_ENTRY_SIZE;
+    const std::vector<uint8_t> unknown = {0x34, 0x12, 3, 0, 0, 0, 'x', 'y', 'z'};
+    bytes.insert(bytes.begin() + record_offset + MAP_DB_RECORD_HEADER_SIZE, unknown.begin(),
+                 unknown.end());
+    bytes[record_offset + 8] = 2;
+    uint8_t* entry = bytes.data() + MAP_DB_HEADER_SIZE;
+    const uint32_t record_size = read_u32(entry + 24) + static_cast<uint32_t>(unknown.size());
+    write_u32(entry + 24, record_size);
+    write_u32(entry + 28, map_db_crc32(bytes.data() + record_offset, record_size));
+
+    MapDb db;
+    ASSERT_TRUE(map_db_open_memory(&db, bytes.data(), bytes.size()));
+    auto loaded = std::make_unique<MapDbMap>();
+    ASSERT_TRUE(map_db_read_map(&db, 0, loaded.get()));
+    EXPECT_EQ(std::memcmp(loaded->cells, maps[0].cells, sizeof(MapDbCell) * 4), 0);
+}
+
+TEST(MapDbTest, CorruptRecordFailsChecksum) {
+    std::vector<MapDbMap> maps(2);
+    maps[0] = *make_map(1, "a", 4, 4);
+    maps[1] = *make_map(2, "b", 4, 4);
+    std::vector<uint8_t> bytes = encode(maps);
+    ASSERT_FALSE(bytes.empty());
+    bytes[bytes.size() - 1] ^= 0x01;
+
+    MapDb db;
+    ASSERT_TRUE(map_db_open_memory(&db, bytes.data(), bytes.size()));
+    MapDbRecord record;
+    EXPECT_TRUE(map_db_open_record(&db, 0, &record));
+    EXPECT_FALSE(map_db_open_record(&db, 1, &record));
+}
+
+TEST(MapDbTest, RejectsInvalidContainers) {
+    MapDb db;
+    const uint8_t text_map[] = {'0', ' ', '1', '\n'};
+    EXPECT_FALSE(map_db_open_memory(&db, text_map, sizeof(text_map)));
+    EXPECT_FALSE(map_db_open_memory(&db, nullptr, 0));
+
+    std::vector<MapDbMap> maps(1);
+    maps[0] = *make_map(1, "short", 2, 2);
+    std::vector<uint8_t> bytes = encode(maps);
+    ASSERT_FALSE(bytes.empty());
+    EXPECT_TRUE(map_db_has_magic(bytes.data(), bytes.size()));
+    EXPECT_FALSE(map_db_open_memory(&db, bytes.data(), MAP_DB_HEADER_SIZE + 8));
+
+    // Records that run past the end of the file are rejected when opened.
+    bytes.resize(bytes.size() - 1);
+    ASSERT_TRUE(map_db_open_memory(&db, bytes.data(), bytes.size()));
+    MapDbRecord record;
+    EXPECT_FALSE(map_db_open_record(&db, 0, &record));
+}
+
+TEST(MapDbTest, EncodeRejectsOversizedMaps) {
+    auto map = make_map(1, "big", 32, 20);
+    map->width = MAP_DB_MAX_COLS + 1;
+    size_t size = 0;
+    EXPECT_EQ(map_db_encode(map.get(), 1, &size), nullptr);
+}
@@ -12,6 +12,8 @@
 #define PATH_SEPARATOR '\\'
 #define PATH_SEPARATOR_STR "\\"
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #define PATH_SEPARATOR '/'
 #define PATH_SEPARATOR_STR "/"
@@ -354,6 +356,77 @@ void* file_read_all(const char* filepath, size_t* size) {
     return buffer;
 }
 
+/**
+ * Map entire file read-only into memory
+ */
+void* file_map_readonly(const char* filepath, size_t* size) {
+    if (!filepath || !size) {
+        return NULL;
+    }
+
+    void* view = NULL;
+    size_t mapped_size = 0;
+#ifdef _WIN32
+    // FILE_SHARE_DELETE lets writers rename a new file over this one while it is mapped.
+    HANDLE file = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    LARGE_INTEGER file_size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        mapped_size = (size_t)file_size.QuadPart;
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    CloseHandle(file);
+    if (!mapping) {
+        return NULL;
+    }
+    // The view keeps the mapping object alive after its handle is closed.
+    view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        return NULL;
+    }
+#else
+    const int fd = open(filepath, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    mapped_size = (size_t)st.st_size;
+    // The mapping stays valid after the descriptor is closed.
+    view = mmap(NULL, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return NULL;
+    }
+#endif
+
+    *size = mapped_size;
+    return view;
+}
+
+/**
+ * Release a mapping returned by file_map_readonly()
+ */
+void file_unmap(void* data, size_t size) {
+    if (!data) {
+        return;
+    }
+#ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
 /**
  * Check if filename has valid characters
  */
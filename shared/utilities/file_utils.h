@@ -133,6 +133,26 @@ bool file_write_atomic(const char* filepath, const void* data, size_t size);
  */
 void* file_read_all(const char* filepath, size_t* size);
 
+/**
+ * Map entire file read-only into memory
+ * Pages are shared with other processes mapping the same file and are only read from disk
+ * when touched. The mapping stays valid if the file is later replaced by a rename.
+ * Caller is responsible for releasing it with file_unmap()
+ *
+ * @param filepath Path to file to map
+ * @param size Output: size of the mapping in bytes
+ * @return Pointer to the mapped file data, NULL on error or for an empty file
+ */
+void* file_map_readonly(const char* filepath, size_t* size);
+
+/**
+ * Release a mapping returned by file_map_readonly()
+ *
+ * @param data Mapped file data
+ * @param size Size reported by file_map_readonly()
+ */
+void file_unmap(void* data, size_t size);
+
 /**
  * Check if filename has valid characters
  *
@@ -1,40 +1,298 @@
 #include "AICentral.h"
+#include <algorithm>
+
+namespace {
+// Repeated 2-bit patterns: every cell dark, and the low bit of every cell.
+constexpr std::uint64_t kAllDark = 0xAAAAAAAAAAAAAAAAull;
+constexpr std::uint64_t kLowBits = 0x5555555555555555ull;
+
+int popcount64(std::uint64_t value) {
+    value = value - ((value >> 1) & kLowBits);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((value * 0x0101010101010101ull) >> 56);
+}
+}  // namespace
 
 AICentral::AICentral(int rows, int cols) {
     if (rows <= 0 || cols <= 0) {
         return;
     }
 
-    _map.assign(rows, std::vector<MapObject>(cols, MapObject::kDark));
+    _rows = rows;
+    _cols = cols;
+    _row_words = (cols + kCellsPerWord - 1) / kCellsPerWord;
+    _knowledge.assign(static_cast<std::size_t>(rows) * _row_words, kAllDark);
+    const std::size_t cells = static_cast<std::size_t>(rows) * cols;
+    _distance.assign(cells, kUnreachable);
+    _field_walkable.assign(cells, 0);
+    _field_queue.resize(cells);
+    _queued.assign(cells, 0);
+    _raised.reserve(cells);
 }
 
 bool AICentral::IsInBounds(int row, int col) const {
-    if (row < 0 || col < 0) {
-        return false;
-    }
-    if (row >= static_cast<int>(_map.size())) {
-        return false;
-    }
-    if (col >= static_cast<int>(_map[row].size())) {
-        return false;
-    }
-
-    return true;
+    return row >= 0 && col >= 0 && row < _rows && col < _cols;
 }
 
 void AICentral::AddToMap(int row, int col, MapObject ob) {
-    if (_map.empty() || !IsInBounds(row, col)) {
+    if (_knowledge.empty() || !IsInBounds(row, col)) {
         return;
     }
 
-    _map[row][col] = ob;
+    std::uint64_t& word = _knowledge[row * _row_words + col / kCellsPerWord];
+    const int shift = 2 * (col % kCellsPerWord);
+    word = (word & ~(std::uint64_t{3} << shift)) |
+           (static_cast<std::uint64_t>(ob) << shift);
 }
 
 AICentral::MapObject AICentral::ReadFromMap(int row, int col) const {
-    if (_map.empty() || !IsInBounds(row, col)) {
+    if (_knowledge.empty() || !IsInBounds(row, col)) {
         // Treat out-of-bounds as walls to keep enemy pathing bounded.
         return MapObject::kWall;
     }
 
-    return _map[row][col];
+    const std::uint64_t word = _knowledge[row * _row_words + col / kCellsPerWord];
+    return static_cast<MapObject>((word >> (2 * (col % kCellsPerWord))) & 3u);
+}
+
+void AICentral::RevealSpan(const GameMap& map, int row, int col_begin, int col_end) {
+    if (_knowledge.empty() || row < 0 || row >= _rows) {
+        return;
+    }
+    col_begin = std::max(col_begin, 0);
+    col_end = std::min(col_end, _cols);
+
+    std::uint64_t* words = &_knowledge[row * _row_words];
+    int col = col_begin;
+    while (col < col_end) {
+        // Build the part of one word covered by the span, then merge it in a single write.
+        const int word_index = col / kCellsPerWord;
+        const int word_end = std::min(col_end, (word_index + 1) * kCellsPerWord);
+        std::uint64_t mask = 0;
+        std::uint64_t value = 0;
+        for (; col < word_end; ++col) {
+            const int shift = 2 * (col % kCellsPerWord);
+            mask |= std::uint64_t{3} << shift;
+            if (!map.AreaIsAvailable(row, col)) {
+                value |= static_cast<std::uint64_t>(MapObject::kWall) << shift;
+            }
+        }
+        words[word_index] = (words[word_index] & ~mask) | value;
+    }
+}
+
+int AICentral::ExploredCount() const {
+    int dark = 0;
+    for (const std::uint64_t word : _knowledge) {
+        // A cell is dark when its high bit is set and its low bit is clear.
+        dark += popcount64((word >> 1) & ~word & kLowBits);
+    }
+    // Padding cells past the last column stay dark and are not part of the map.
+    const int padding = _rows * (_row_words * kCellsPerWord - _cols);
+    return _rows * _cols - (dark - padding);
+}
+
+void AICentral::UpdatePlayerCell(const GameMap& map, int row, int col) {
+    if (_knowledge.empty()) {
+        return;
+    }
+
+    if (row != _player_cell.row || col != _player_cell.col || &map != _field_map) {
+        _player_cell = GameMap::CellCoord{row, col};
+        RebuildFlowField(map);
+        return;
+    }
+    if (map.Revision() == _field_revision) {
+        return;
+    }
+
+    _changed_cells.clear();
+    if (!map.CollectChangedCells(_field_revision, &_changed_cells)) {
+        RebuildFlowField(map);
+        return;
+    }
+    RepairFlowField(map);
+}
+
+void AICentral::RebuildFlowField(const GameMap& map) {
+    _field_map = &map;
+    _field_revision = map.Revision();
+    std::fill(_distance.begin(), _distance.end(), kUnreachable);
+    std::fill(_queued.begin(), _queued.end(), 0);
+    _queue_head = 0;
+    _queue_size = 0;
+    for (int row = 0; row < _rows; ++row) {
+        for (int col = 0; col < _cols; ++col) {
+            _field_walkable[row * _cols + col] = map.AreaIsAvailable(row, col) ? 1 : 0;
+        }
+    }
+
+    if (!IsInBounds(_player_cell.row, _player_cell.col)) {
+        return;
+    }
+    const int start = _player_cell.row * _cols + _player_cell.col;
+    if (!_field_walkable[start]) {
+        return;
+    }
+
+    // Plain BFS: with every cell queued at most once the ring never wraps onto live entries.
+    _distance[start] = 0;
+    Enqueue(start);
+    PropagateLowered();
+}
+
+void AICentral::RepairFlowField(const GameMap& map) {
+    _field_revision = map.Revision();
+    const int player = IsInBounds(_player_cell.row, _player_cell.col)
+                           ? _player_cell.row * _cols + _player_cell.col
+                           : -1;
+
+    // Raise phase: blocked cells lose their distance, and so does every cell that was only
+    // reachable through them.
+    _raised.clear();
+    for (const GameMap::CellCoord& cell : _changed_cells) {
+        const int index = cell.row * _cols + cell.col;
+        const std::uint8_t walkable = map.AreaIsAvailable(cell.row, cell.col) ? 1 : 0;
+        if (walkable == _field_walkable[index]) {
+            continue;
+        }
+        _field_walkable[index] = walkable;
+        if (index == player) {
+            RebuildFlowField(map);
+            return;
+        }
+        if (walkable) {
+            _raised.push_back(index);
+            continue;
+        }
+        _distance[index] = kUnreachable;
+        Enqueue(index);
+    }
+    while (_queue_size > 0) {
+        const int index = _field_queue[_queue_head];
+        _queue_head = (_queue_head + 1) % _field_queue.size();
+        --_queue_size;
+        _queued[index] = 0;
+
+        if (_field_walkable[index] && _distance[index] != kUnreachable && index != player) {
+            if (HasSupport(index)) {
+                continue;
+            }
+            _distance[index] = kUnreachable;
+            _raised.push_back(index);
+        }
+        const int row = index / _cols;
+        const int col = index % _cols;
+        const auto check = [&](int next_row, int next_col) {
+            if (IsInBounds(next_row, next_col)) {
+                const int next = next_row * _cols + next_col;
+                if (_field_walkable[next] && _distance[next] != kUnreachable) {
+                    Enqueue(next);
+                }
+            }
+        };
+        check(row, col - 1);
+        check(row, col + 1);
+        check(row - 1, col);
+        check(row + 1, col);
+    }
+
+    // Lower phase: raised and newly opened cells take the best distance their neighbours
+    // still offer, and any improvement spreads outward.
+    for (const int index : _raised) {
+        PullFromNeighbours(index);
+    }
+    PropagateLowered();
+}
+
+void AICentral::Enqueue(int index) {
+    if (_queued[index]) {
+        return;
+    }
+    _queued[index] = 1;
+    _field_queue[(_queue_head + _queue_size) % _field_queue.size()] = index;
+    ++_queue_size;
+}
+
+bool AICentral::HasSupport(int index) const {
+    const int row = index / _cols;
+    const int col = index % _cols;
+    const std::uint16_t wanted = static_cast<std::uint16_t>(_distance[index] - 1);
+    return DistanceToPlayer(row, col - 1) == wanted || DistanceToPlayer(row, col + 1) == wanted ||
+           DistanceToPlayer(row - 1, col) == wanted || DistanceToPlayer(row + 1, col) == wanted;
+}
+
+void AICentral::PullFromNeighbours(int index) {
+    if (!_field_walkable[index]) {
+        return;
+    }
+    const int row = index / _cols;
+    const int col = index % _cols;
+    const std::uint16_t best = std::min(
+        std::min(DistanceToPlayer(row, col - 1), DistanceToPlayer(row, col + 1)),
+        std::min(DistanceToPlayer(row - 1, col), DistanceToPlayer(row + 1, col)));
+    if (best != kUnreachable && best + 1 < _distance[index]) {
+        _distance[index] = static_cast<std::uint16_t>(best + 1);
+        Enqueue(index);
+    }
+}
+
+void AICentral::PropagateLowered() {
+    while (_queue_size > 0) {
+        const int index = _field_queue[_queue_head];
+        _queue_head = (_queue_head + 1) % _field_queue.size();
+        --_queue_size;
+        _queued[index] = 0;
+        if (_distance[index] == kUnreachable) {
+            continue;
+        }
+
+        const std::uint16_t next_distance = static_cast<std::uint16_t>(_distance[index] + 1);
+        const int row = index / _cols;
+        const int col = index % _cols;
+        const auto visit = [&](int next_row, int next_col) {
+            if (!IsInBounds(next_row, next_col)) {
+                return;
+            }
+            const int next = next_row * _cols + next_col;
+            if (_field_walkable[next] && next_distance < _distance[next]) {
+                _distance[next] = next_distance;
+                Enqueue(next);
+            }
+        };
+        visit(row, col - 1);
+        visit(row, col + 1);
+        visit(row - 1, col);
+        visit(row + 1, col);
+    }
+}
+
+std::uint16_t AICentral::DistanceToPlayer(int row, int col) const {
+    if (_distance.empty() || !IsInBounds(row, col)) {
+        return kUnreachable;
+    }
+
+    return _distance[static_cast<std::size_t>(row) * _cols + col];
+}
+
+Character::Direction AICentral::DirectionToPlayer(int row, int col) const {
+    std::uint16_t best = DistanceToPlayer(row, col);
+    Character::Direction direction = Character::Direction::kNone;
+    if (best == kUnreachable || best == 0) {
+        return direction;
+    }
+
+    const auto consider = [&](int next_row, int next_col, Character::Direction candidate) {
+        const std::uint16_t distance = DistanceToPlayer(next_row, next_col);
+        if (distance < best) {
+            best = distance;
+            direction = candidate;
+        }
+    };
+    consider(row, col - 1, Character::Direction::kLeft);
+    consider(row, col + 1, Character::Direction::kRight);
+    consider(row - 1, col, Character::Direction::kUp);
+    consider(row + 1, col, Character::Direction::kDown);
+    return direction;
 }
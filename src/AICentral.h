@@ -1,11 +1,19 @@
 #ifndef AICENTRAL_H
 #define AICENTRAL_H
 
+#include <cstdint>
 #include <vector>
 
+#include "character.h"
+#include "gamemap.h"
+
 class AICentral {
    public:
-    enum class MapObject { kRoad, kWall, kDark };
+    // Values double as the 2-bit codes stored in the knowledge grid.
+    enum class MapObject : std::uint8_t { kRoad = 0, kWall = 1, kDark = 2 };
+
+    // Distance reported for cells the player cannot be reached from.
+    static constexpr std::uint16_t kUnreachable = 0xFFFF;
 
     AICentral(int rows, int cols);
 
@@ -19,19 +27,71 @@ class AICentral {
 
     ~AICentral() = default;
 
-    // FOR FUTURE IMPLEMENTATIONS.
-    // TODO : Find a way to calculate heuristic value from any point to any point...
-    // TODO : Implement Last known position of player.
-    // TODO : Implement Ask For direction
-
     void AddToMap(int row, int col, MapObject ob);
 
     MapObject ReadFromMap(int row, int col) const;
 
+    // Charts cells [col_begin, col_end) of `row` as road or wall according to `map`, writing a
+    // whole word of the knowledge grid at a time. The span is clipped to the grid.
+    void RevealSpan(const GameMap& map, int row, int col_begin, int col_end);
+
+    // Number of cells that are no longer dark.
+    int ExploredCount() const;
+
+    // Records the player's last known cell and keeps the distance field toward it current. A new player
+    // cell rebuilds the field with a BFS over walkable cells; map damage since the last call is
+    // read from the map's change log and repaired locally. Does nothing if neither changed, so
+    // it is cheap to call every tick.
+    void UpdatePlayerCell(const GameMap& map, int row, int col);
+
+    // Cell passed to the latest UpdatePlayerCell(); (-1, -1) before the player was first seen.
+    GameMap::CellCoord LastKnownPlayerCell() const { return _player_cell; }
+
+    // Steps from (row, col) to the player's last known cell, or kUnreachable.
+    std::uint16_t DistanceToPlayer(int row, int col) const;
+
+    // Neighbour direction that descends the distance field, kNone at the player or when the
+    // player cannot be reached. Ties prefer left, right, up, down in that order.
+    Character::Direction DirectionToPlayer(int row, int col) const;
+
    private:
     bool IsInBounds(int row, int col) const;
 
-    std::vector<std::vector<MapObject>> _map;
+    void RebuildFlowField(const GameMap& map);
+
+    // LPA*-style repair for cells whose walkability changed: distances that lost their only
+    // shorter neighbour are raised to unreachable, then every affected cell is lowered again
+    // from its still-valid neighbours. Only the region whose distances change is visited.
+    void RepairFlowField(const GameMap& map);
+
+    void Enqueue(int index);
+
+    bool HasSupport(int index) const;
+
+    void PullFromNeighbours(int index);
+
+    void PropagateLowered();
+
+    // Explored knowledge, 2 bits per cell, 32 cells per word, each row starting on a new word.
+    static constexpr int kCellsPerWord = 32;
+    std::vector<std::uint64_t> _knowledge;
+    int _row_words{0};
+
+    int _rows{0};
+    int _cols{0};
+    GameMap::CellCoord _player_cell{-1, -1};
+    const GameMap* _field_map{nullptr};
+    std::uint64_t _field_revision{0};
+    // Row-major distance per cell and the walkability it was computed from. _field_queue is a
+    // ring buffer holding each cell at most once (tracked by _queued), so it never grows.
+    std::vector<std::uint16_t> _distance;
+    std::vector<std::uint8_t> _field_walkable;
+    std::vector<int> _field_queue;
+    std::vector<std::uint8_t> _queued;
+    std::size_t _queue_head{0};
+    std::size_t _queue_size{0};
+    std::vector<int> _raised;
+    std::vector<GameMap::CellCoord> _changed_cells;
 };
 
 #endif
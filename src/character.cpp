@@ -6,6 +6,8 @@ Character::Character(int grid_size, int startX, int startY, Direction direction,
     : _grid_size(grid_size),
       _pos_x(startX),
       _pos_y(startY),
+      _prev_x(startX),
+      _prev_y(startY),
       _direction(direction),
       _speed(speed),
       _map_ptr(map_ptr) {}
\ No newline at end of file
@@ -19,6 +19,16 @@ class Character {
 
     int GetY() const { return _pos_y; }
 
+    // Position at the start of the current simulation tick, used for render interpolation.
+    int GetPrevX() const { return _prev_x; }
+
+    int GetPrevY() const { return _prev_y; }
+
+    void SnapshotPosition() {
+        _prev_x = _pos_x;
+        _prev_y = _pos_y;
+    }
+
     void SetDirection(Direction direction) { _direction = direction; }
 
     Direction GetDirection() const { return _direction; }
@@ -35,6 +45,8 @@ class Character {
     int _grid_size;
     int _pos_x;
     int _pos_y;
+    int _prev_x;
+    int _prev_y;
     Direction _direction;
     bool _alive{true};
     bool _moving{false};
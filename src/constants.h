@@ -6,9 +6,19 @@ const int GRID_SIZE = 32;
 const int GRID_WIDTH = 32;
 const int GRID_HEIGHT = 20;
 
+// Enemies
+const int ENEMY_COUNT = 3;  // initial enemy spawns, see docs/map_db_format.md
+const int ENEMY_SPEED = 2;
+const int ENEMY_CHASE_DISTANCE = 8;  // path length in cells at which enemies start chasing
+const int PROJECTILE_CAPACITY = 128;  // shots in flight at once; extra shots are dropped
+const int PROJECTILE_SPEED = 8;
+const int WORKER_THREADS = 0;  // simulation threads including the main one; 0 = one per core
+
 // Performance
 const int TARGET_FPS = 60;
 const int MS_PER_FRAME = 1000 / TARGET_FPS;
+const int TICK_RATE = 60;  // fixed simulation ticks per second, independent of render rate
+const int MAX_TICKS_PER_FRAME = 5;
 
 // Character rendering
 const int EYE_OFFSET_X = 8;
@@ -1,35 +1,14 @@
 #include "controller.h"
 #include <SDL3/SDL.h>
 #include <iostream>
-#include "player.h"
-
-void Controller::ChangeDirection(Player& player, Player::Direction input) {
-    if (input == Player::Direction::kNone) {
-        return player.IsMoving(false);
-    }
-
-    if (player.GetDirection() != input) {
-        player.IsMoving(false);
-        return player.SetDirection(input);
-    } else {
-        return player.IsMoving(true);
-    }
-}
-
-void Controller::FireProjectile(Player& player) const {
-    if (player.DamageFrontSubtile()) {
-        std::cout << "Subtile damaged." << std::endl;
-    }
-}
 
 void Controller::HandlePause() const {
     std::cout << "Paused" << std::endl;
 }
 
-void Controller::HandleInput(bool& running, Player& player) const {
+PlayerInput Controller::HandleInput(bool& running) const {
     const bool* keystates = SDL_GetKeyboardState(nullptr);  // SDL3 returns bool*
-    bool fire_pressed = false;
-    bool pause_pressed = false;
+    PlayerInput input;
 
     SDL_Event e;
     while (SDL_PollEvent(&e)) {
@@ -37,37 +16,28 @@ void Controller::HandleInput(bool& running, Player& player) const {
             running = false;
         } else if (e.type == SDL_EVENT_KEY_DOWN) {
             if (e.key.scancode == SDL_SCANCODE_F) {
-                fire_pressed = true;
+                input.fire = true;
             } else if (e.key.scancode == SDL_SCANCODE_P) {
-                pause_pressed = true;
+                input.pause = true;
             }
         }
     }
 
-    if (fire_pressed) {
-        FireProjectile(player);
-    }
-
-    if (pause_pressed || keystates[SDL_SCANCODE_P]) {
+    if (input.pause || keystates[SDL_SCANCODE_P]) {
+        input.pause = true;
         HandlePause();
-        return;
+        return input;
     }
 
     if (keystates[SDL_SCANCODE_UP]) {
-        return ChangeDirection(player, Character::Direction::kUp);
-    }
-
-    if (keystates[SDL_SCANCODE_DOWN]) {
-        return ChangeDirection(player, Character::Direction::kDown);
-    }
-
-    if (keystates[SDL_SCANCODE_LEFT]) {
-        return ChangeDirection(player, Character::Direction::kLeft);
-    }
-
-    if (keystates[SDL_SCANCODE_RIGHT]) {
-        return ChangeDirection(player, Character::Direction::kRight);
+        input.direction = Character::Direction::kUp;
+    } else if (keystates[SDL_SCANCODE_DOWN]) {
+        input.direction = Character::Direction::kDown;
+    } else if (keystates[SDL_SCANCODE_LEFT]) {
+        input.direction = Character::Direction::kLeft;
+    } else if (keystates[SDL_SCANCODE_RIGHT]) {
+        input.direction = Character::Direction::kRight;
     }
 
-    return ChangeDirection(player, Character::Direction::kNone);
+    return input;
 }
@@ -2,18 +2,15 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
-#include "player.h"
+#include "player_input.h"
 
 class Controller {
    public:
-    void HandleInput(bool& running, Player& player) const;
+    // Polls SDL events and the keyboard state and returns the resulting player commands.
+    PlayerInput HandleInput(bool& running) const;
 
    private:
-    static void ChangeDirection(Player& player, Player::Direction input);
-
-    void FireProjectile(Player& player) const;
-
     void HandlePause() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,261 @@
+#include "enemy_store.h"
+#include <array>
+#include "constants.h"
+
+namespace {
+using Direction = Character::Direction;
+
+constexpr std::size_t kEnemiesPerChunk = 64;
+// Random cells tried when picking an exploration goal before falling back to a random turn.
+constexpr int kGoalSamples = 8;
+constexpr GameMap::CellCoord kNoGoal{-1, -1};
+constexpr GameMap::CellCoord kNoReveal{-1, -1};
+
+// splitmix64 step. Each enemy owns one state word, so decisions don't depend on which thread
+// or in what order enemies are processed.
+std::uint32_t NextRandom(std::uint64_t& state) {
+    state += 0x9E3779B97F4A7C15ull;
+    std::uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+}
+
+int RandomNum(std::uint64_t& state, int size) {
+    // Plain modulo instead of std::uniform_int_distribution: the distribution's output is
+    // implementation-defined, which would break replaying a seed across standard libraries.
+    return static_cast<int>(NextRandom(state) % static_cast<std::uint32_t>(size));
+}
+
+struct DirectionList {
+    std::array<Direction, 4> items{};
+    int count{0};
+
+    void Add(Direction direction) { items[count++] = direction; }
+};
+}  // namespace
+
+EnemyStore::EnemyStore(int grid_size, std::shared_ptr<GameMap> map_ptr,
+                       std::shared_ptr<AICentral> ai, std::shared_ptr<std::mt19937> rng)
+    : _grid_size(grid_size),
+      _map_ptr(map_ptr),
+      _ai(ai),
+      _rng(rng),
+      _decide_range([this](std::size_t begin, std::size_t end) { DecideRange(begin, end); }) {}
+
+std::size_t EnemyStore::Spawn(int startX, int startY, Character::Direction direction, int speed) {
+    _pos_x.push_back(startX);
+    _pos_y.push_back(startY);
+    _prev_x.push_back(startX);
+    _prev_y.push_back(startY);
+    _speed.push_back(speed);
+    _direction.push_back(direction);
+    _alive.push_back(1);
+    const std::uint64_t high = (*_rng)();
+    _rng_state.push_back((high << 32) | (*_rng)());
+    _reveal_at.push_back(kNoReveal);
+    _goal.push_back(kNoGoal);
+    if (_path_finders.size() * kEnemiesPerChunk < _pos_x.size()) {
+        _path_finders.emplace_back(_map_ptr->RowCount(), _map_ptr->ColCount());
+    }
+    return _pos_x.size() - 1;
+}
+
+void EnemyStore::Reserve(std::size_t count) {
+    _pos_x.reserve(count);
+    _pos_y.reserve(count);
+    _prev_x.reserve(count);
+    _prev_y.reserve(count);
+    _speed.reserve(count);
+    _direction.reserve(count);
+    _alive.reserve(count);
+    _rng_state.reserve(count);
+    _reveal_at.reserve(count);
+    _goal.reserve(count);
+    _path_finders.reserve((count + kEnemiesPerChunk - 1) / kEnemiesPerChunk);
+}
+
+std::size_t EnemyStore::AliveCount() const {
+    std::size_t alive = 0;
+    for (std::uint8_t flag : _alive) {
+        alive += flag;
+    }
+    return alive;
+}
+
+void EnemyStore::Update(WorkerPool& workers) {
+    // Decide phase: enemies only touch their own slots and read shared state.
+    workers.ParallelFor(Size(), kEnemiesPerChunk, _decide_range);
+
+    // Commit phase: chart each probed neighbourhood in the shared AI map in a fixed order, as
+    // one span per row rather than one 2-bit write per cell.
+    for (GameMap::CellCoord& cell : _reveal_at) {
+        if (cell.row < 0) {
+            continue;
+        }
+        _ai->RevealSpan(*_map_ptr, cell.row - 1, cell.col, cell.col + 1);
+        _ai->RevealSpan(*_map_ptr, cell.row, cell.col - 1, cell.col + 2);
+        _ai->RevealSpan(*_map_ptr, cell.row + 1, cell.col, cell.col + 1);
+        cell = kNoReveal;
+    }
+}
+
+void EnemyStore::DecideRange(std::size_t begin, std::size_t end) {
+    PathFinder& path_finder = _path_finders[begin / kEnemiesPerChunk];
+    for (std::size_t id = begin; id < end; ++id) {
+        _prev_x[id] = _pos_x[id];
+        _prev_y[id] = _pos_y[id];
+        if (!_alive[id]) {
+            continue;
+        }
+
+        if (!(_pos_y[id] % _grid_size) && !(_pos_x[id] % _grid_size)) {
+            const Direction previous = _direction[id];
+            ChooseDirection(id, path_finder);
+            // Turning at an intersection costs the enemy this tick.
+            if (previous != _direction[id]) {
+                continue;
+            }
+        }
+        Step(id);
+    }
+}
+
+void EnemyStore::ChooseDirection(std::size_t id, PathFinder& path_finder) {
+    // Check options; if any neighbour is unexplored, the commit phase charts this cell's
+    // neighbourhood.
+    DirectionList options;
+    DirectionList non_visited;
+    const int row = _pos_y[id] / _grid_size;
+    const int col = _pos_x[id] / _grid_size;
+    const auto probe = [&](int probe_row, int probe_col, Direction direction) {
+        const bool available = _map_ptr->AreaIsAvailable(probe_row, probe_col);
+        if (available) {
+            options.Add(direction);
+        }
+        if (_ai->ReadFromMap(probe_row, probe_col) == AICentral::MapObject::kDark) {
+            _reveal_at[id] = GameMap::CellCoord{row, col};
+            if (available) {
+                non_visited.Add(direction);
+            }
+        }
+    };
+    probe(row, col - 1, Direction::kLeft);
+    probe(row, col + 1, Direction::kRight);
+    probe(row - 1, col, Direction::kUp);
+    probe(row + 1, col, Direction::kDown);
+
+    // Close enough to the player: follow the shared distance field instead of exploring.
+    if (_ai->DistanceToPlayer(row, col) <= ENEMY_CHASE_DISTANCE) {
+        const Direction chase = _ai->DirectionToPlayer(row, col);
+        if (chase != Direction::kNone) {
+            _direction[id] = chase;
+            return;
+        }
+    }
+
+    if (non_visited.count != 0) {
+        _direction[id] = non_visited.items[RandomNum(_rng_state[id], non_visited.count)];
+        return;
+    }
+    const Direction toward_goal = DirectionToGoal(id, row, col, path_finder);
+    if (toward_goal != Direction::kNone) {
+        _direction[id] = toward_goal;
+    } else if (options.count != 0) {
+        _direction[id] = options.items[RandomNum(_rng_state[id], options.count)];
+    }
+}
+
+Direction EnemyStore::DirectionToGoal(std::size_t id, int row, int col,
+                                      PathFinder& path_finder) {
+    GameMap::CellCoord& goal = _goal[id];
+    const bool goal_done = goal.row < 0 || (goal.row == row && goal.col == col) ||
+                           _ai->ReadFromMap(goal.row, goal.col) != AICentral::MapObject::kDark;
+    if (goal_done || !path_finder.FindPath(*_map_ptr, GameMap::CellCoord{row, col}, goal)) {
+        goal = kNoGoal;
+        for (int i = 0; i < kGoalSamples; ++i) {
+            const GameMap::CellCoord candidate{RandomNum(_rng_state[id], _map_ptr->RowCount()),
+                                               RandomNum(_rng_state[id], _map_ptr->ColCount())};
+            const bool here = candidate.row == row && candidate.col == col;
+            if (!here &&
+                _ai->ReadFromMap(candidate.row, candidate.col) == AICentral::MapObject::kDark &&
+                path_finder.FindPath(*_map_ptr, GameMap::CellCoord{row, col}, candidate)) {
+                goal = candidate;
+                break;
+            }
+        }
+        if (goal.row < 0) {
+            return Direction::kNone;
+        }
+    }
+
+    const GameMap::CellCoord next = path_finder.Path().front();
+    if (next.row < row) {
+        return Direction::kUp;
+    }
+    if (next.row > row) {
+        return Direction::kDown;
+    }
+    return next.col < col ? Direction::kLeft : Direction::kRight;
+}
+
+void EnemyStore::Step(std::size_t id) {
+    int& pos_x = _pos_x[id];
+    int& pos_y = _pos_y[id];
+    const int speed = _speed[id];
+    Direction& direction = _direction[id];
+
+    switch (direction) {
+        case Direction::kUp:
+            if (pos_y % _grid_size) {
+                pos_y -= speed;
+            } else {
+                if (_map_ptr->AreaIsAvailable((pos_y - speed) / _grid_size, pos_x / _grid_size)) {
+                    pos_y -= speed;
+                } else {
+                    direction = Direction::kLeft;
+                }
+            }
+            break;
+
+        case Direction::kDown:
+            if (pos_y % _grid_size) {
+                pos_y += speed;
+            } else {
+                if (_map_ptr->AreaIsAvailable(((pos_y + speed) / _grid_size) + 1,
+                                              pos_x / _grid_size)) {
+                    pos_y += speed;
+                } else {
+                    direction = Direction::kRight;
+                }
+            }
+            break;
+
+        case Direction::kLeft:
+            if (pos_x % _grid_size) {
+                pos_x -= speed;
+            } else {
+                if (_map_ptr->AreaIsAvailable(pos_y / _grid_size, (pos_x - speed) / _grid_size)) {
+                    pos_x -= speed;
+                } else {
+                    direction = Direction::kDown;
+                }
+            }
+            break;
+
+        case Direction::kRight:
+            if (pos_x % _grid_size) {
+                pos_x += speed;
+            } else {
+                if (_map_ptr->AreaIsAvailable(pos_y / _grid_size,
+                                              ((pos_x + speed) / _grid_size) + 1)) {
+                    pos_x += speed;
+                } else {
+                    direction = Direction::kUp;
+                }
+            }
+            break;
+        case Direction::kNone:
+            break;
+    }
+}
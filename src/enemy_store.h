@@ -0,0 +1,106 @@
+#ifndef ENEMY_STORE_H
+#define ENEMY_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "AICentral.h"
+#include "character.h"
+#include "gamemap.h"
+#include "path_finder.h"
+#include "worker_pool.h"
+
+// Data-oriented storage for all enemies: each attribute lives in its own contiguous array indexed
+// by enemy id, and Update() advances every enemy in one pass.
+//
+// Update() runs in two phases so it can be split across a WorkerPool and still be deterministic:
+// a parallel decide phase in which every enemy reads the map and the start-of-tick AICentral
+// knowledge, picks a direction from its own random stream and moves; then a serial commit phase
+// that reveals the cells around each enemy that saw dark neighbours, in id order.
+//
+// An enemy whose neighbours are all charted routes toward a dark cell it picked with A*, using
+// the PathFinder of the chunk it is decided in, instead of wandering at random.
+class EnemyStore {
+   public:
+    EnemyStore(int grid_size, std::shared_ptr<GameMap> map_ptr, std::shared_ptr<AICentral> ai,
+               std::shared_ptr<std::mt19937> rng);
+
+    // `_decide_range` captures `this`, so a copied or moved store would update the original.
+    EnemyStore(const EnemyStore& source) = delete;
+
+    EnemyStore(EnemyStore&& source) = delete;
+
+    EnemyStore& operator=(const EnemyStore& source) = delete;
+
+    EnemyStore& operator=(EnemyStore&& source) = delete;
+
+    // Adds an enemy and returns its id. Ids are stable for the lifetime of the store.
+    std::size_t Spawn(int startX, int startY, Character::Direction direction, int speed);
+
+    void Reserve(std::size_t count);
+
+    // Advances every living enemy by one simulation tick.
+    void Update(WorkerPool& workers);
+
+    std::size_t Size() const { return _pos_x.size(); }
+
+    std::size_t Capacity() const { return _pos_x.capacity(); }
+
+    std::size_t AliveCount() const;
+
+    int GetX(std::size_t id) const { return _pos_x[id]; }
+
+    int GetY(std::size_t id) const { return _pos_y[id]; }
+
+    int GetPrevX(std::size_t id) const { return _prev_x[id]; }
+
+    int GetPrevY(std::size_t id) const { return _prev_y[id]; }
+
+    Character::Direction GetDirection(std::size_t id) const { return _direction[id]; }
+
+    int GetSpeed(std::size_t id) const { return _speed[id]; }
+
+    bool IsAlive(std::size_t id) const { return _alive[id] != 0; }
+
+    void Kill(std::size_t id) { _alive[id] = 0; }
+
+   private:
+    void DecideRange(std::size_t begin, std::size_t end);
+
+    void ChooseDirection(std::size_t id, PathFinder& path_finder);
+
+    // Next step toward the enemy's exploration goal, picking a new goal when it has been reached
+    // or charted. kNone when no reachable dark cell was found.
+    Character::Direction DirectionToGoal(std::size_t id, int row, int col,
+                                         PathFinder& path_finder);
+
+    void Step(std::size_t id);
+
+    int _grid_size;
+    std::shared_ptr<GameMap> _map_ptr;
+    std::shared_ptr<AICentral> _ai;
+    // Shared with the owning Game; only used to seed each enemy's own stream on Spawn().
+    std::shared_ptr<std::mt19937> _rng;
+    WorkerPool::RangeFunction _decide_range;
+
+    std::vector<int> _pos_x;
+    std::vector<int> _pos_y;
+    std::vector<int> _prev_x;
+    std::vector<int> _prev_y;
+    std::vector<int> _speed;
+    std::vector<Character::Direction> _direction;
+    std::vector<std::uint8_t> _alive;
+    std::vector<std::uint64_t> _rng_state;
+    // Cell whose neighbourhood the commit phase reveals in AICentral; row -1 when nothing new
+    // was seen this tick.
+    std::vector<GameMap::CellCoord> _reveal_at;
+    // Dark cell each enemy is heading for; row -1 when it has none.
+    std::vector<GameMap::CellCoord> _goal;
+    // One search workspace per kEnemiesPerChunk ids. A chunk is decided by one thread at a time,
+    // so the finders need no locking and queries never allocate.
+    std::vector<PathFinder> _path_finders;
+};
+
+#endif  // ENEMY_STORE_H
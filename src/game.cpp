@@ -1,37 +1,101 @@
 // Copied From CppND-Capstone-Snake-Game
 #include "game.h"
-#include <SDL3/SDL.h>
-#include <iostream>
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <thread>
+#include "constants.h"
+
+#ifndef PLAYGAME_HEADLESS
+#include <SDL3/SDL.h>
+#include "controller.h"
+#include "renderer.h"
 
 namespace {
+constexpr uint64_t kNsPerMs = 1000000;
+constexpr uint64_t kNsPerSecond = 1000000000;
+
 uint64_t SDL_GetTicksMS() {
     return SDL_GetTicksNS() / 1000000;
 }
 }  // namespace
+#endif
+
+namespace {
+std::size_t extra_worker_count(int worker_threads) {
+    std::size_t total = static_cast<std::size_t>(worker_threads);
+    if (total == 0) {
+        total = std::thread::hardware_concurrency();
+    }
+    // The thread calling Update() always takes part, so it is not counted as a worker.
+    return total > 1 ? total - 1 : 0;
+}
+}  // namespace
 
 Game::Game(int grid_size, int grid_width, int grid_height, std::shared_ptr<GameMap> map_ptr,
-           std::shared_ptr<AICentral> aiCentral)
-    : player(grid_size, grid_size * (grid_width / 2), grid_size * (grid_height - 2),
+           std::shared_ptr<AICentral> aiCentral, std::uint32_t seed, int enemy_count,
+           int worker_threads)
+    : _seed(seed),
+      _rng(std::make_shared<std::mt19937>(seed)),
+      player(grid_size, grid_size * (grid_width / 2), grid_size * (grid_height - 2),
              Character::Direction::kUp, 4, map_ptr),
-      enemy(grid_size, grid_size * (grid_width / 2), grid_size * (2), Character::Direction::kDown,
-            2, map_ptr, aiCentral),
+      enemies(grid_size, map_ptr, aiCentral, _rng),
       _aiCentral(aiCentral),
+      projectiles(grid_size, PROJECTILE_CAPACITY, map_ptr),
       _map_ptr(map_ptr),
-      _grid_size(grid_size) {}
+      _grid_size(grid_size),
+      _workers(extra_worker_count(worker_threads)),
+      _visibility(map_ptr->RowCount(), map_ptr->ColCount()),
+      _enemy_grid(map_ptr->RowCount(), map_ptr->ColCount(), grid_size) {
+    SpawnEnemies(enemy_count, grid_width);
+}
+
+void Game::SpawnEnemies(int count, int grid_width) {
+    enemies.Reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        // Spread spawns evenly along the top of the map; a single enemy starts centred.
+        const int col = (i + 1) * grid_width / (count + 1);
+        const GameMap::CellCoord cell = FindSpawnCell(2, col);
+        enemies.Spawn(_grid_size * cell.col, _grid_size * cell.row, Character::Direction::kDown,
+                      ENEMY_SPEED);
+    }
+}
 
+GameMap::CellCoord Game::FindSpawnCell(int row, int col) const {
+    const int max_radius = std::max(_map_ptr->RowCount(), _map_ptr->ColCount());
+    for (int radius = 0; radius <= max_radius; ++radius) {
+        for (int d_row = -radius; d_row <= radius; ++d_row) {
+            for (int d_col = -radius; d_col <= radius; ++d_col) {
+                if (std::max(std::abs(d_row), std::abs(d_col)) != radius) {
+                    continue;
+                }
+                if (_map_ptr->AreaIsAvailable(row + d_row, col + d_col)) {
+                    return GameMap::CellCoord{row + d_row, col + d_col};
+                }
+            }
+        }
+    }
+    return GameMap::CellCoord{row, col};
+}
+
+#ifndef PLAYGAME_HEADLESS
 void Game::Run(Controller const& controller, Renderer& renderer,
-               std::size_t target_frame_duration) {
+               std::size_t target_frame_duration, std::size_t tick_rate,
+               const InputRecording* replay) {
+    const uint64_t tick_duration_ns = kNsPerSecond / (tick_rate > 0 ? tick_rate : TICK_RATE);
+    const uint64_t target_frame_ns = target_frame_duration * kNsPerMs;
     uint64_t title_timestamp = SDL_GetTicksMS();
     uint64_t frame_start;
     uint64_t frame_end;
     uint64_t frame_duration;
+    uint64_t accumulator = 0;
+    bool pending_fire = false;
     int frame_count = 0;
     bool running = true;
 
     // Pre-game loop for "Press any key to start"
     bool game_started = false;
-    while (!game_started && running) {
+    while (!game_started && running && !replay) {
         SDL_Event e;
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_EVENT_QUIT) {
@@ -40,34 +104,204 @@ void Game::Run(Controller const& controller, Renderer& renderer,
                 game_started = true;
             }
         }
-        renderer.Render(player, enemy);
+        renderer.Render(player, enemies, projectiles, 1.0f);
         SDL_DelayNS(10000000);  // 10ms delay
     }
 
+    uint64_t previous_time = SDL_GetTicksNS();
     while (running) {
-        frame_start = SDL_GetTicksMS();
+        frame_start = SDL_GetTicksNS();
 
         // Input, Update, Render - the main game loop.
-        controller.HandleInput(running, player);
+        const PlayerInput frame_input = controller.HandleInput(running);
+        // A fire press is latched until a tick consumes it, so it is never lost or repeated.
+        pending_fire = pending_fire || frame_input.fire;
+
+        // Simulation advances in fixed ticks regardless of how fast frames are rendered.
+        accumulator += frame_start - previous_time;
+        previous_time = frame_start;
+        int ticks = 0;
+        while (accumulator >= tick_duration_ns && ticks < MAX_TICKS_PER_FRAME) {
+            if (replay) {
+                if (_tick >= replay->TickCount()) {
+                    running = false;
+                    break;
+                }
+                Update(replay->At(static_cast<std::size_t>(_tick)));
+            } else {
+                PlayerInput tick_input = frame_input;
+                tick_input.fire = pending_fire;
+                pending_fire = false;
+                Update(tick_input);
+            }
+            accumulator -= tick_duration_ns;
+            ++ticks;
+        }
+        if (ticks == MAX_TICKS_PER_FRAME && accumulator >= tick_duration_ns) {
+            // Too far behind (e.g. after a stall): drop the backlog instead of spiralling.
+            accumulator = 0;
+        }
 
-        // Enemy movement runs inline to avoid per-frame async allocation/synchronization overhead.
-        enemy.Move();
-        renderer.Render(player, enemy);
+        const float alpha =
+            static_cast<float>(accumulator) / static_cast<float>(tick_duration_ns);
+        renderer.Render(player, enemies, projectiles, alpha);
 
-        frame_end = SDL_GetTicksMS();
+        frame_end = SDL_GetTicksNS();
 
         frame_count++;
         frame_duration = frame_end - frame_start;
 
-        if (frame_end - title_timestamp >= 1000) {
+        if (frame_end / kNsPerMs - title_timestamp >= 1000) {
             renderer.UpdateWindowTitle(score, frame_count);
             frame_count = 0;
-            title_timestamp = frame_end;
+            title_timestamp = frame_end / kNsPerMs;
+        }
+
+        if (frame_duration < target_frame_ns) {
+            SDL_DelayNS(target_frame_ns - frame_duration);
+        }
+    }
+}
+
+#endif
+
+void Game::StartRecording(int map_index) {
+    _recording = InputRecording(_seed, _map_ptr->ContentHash(), static_cast<int>(enemies.Size()),
+                                map_index);
+    _recording_enabled = true;
+}
+
+const InputRecording& Game::FinishRecording() {
+    _recording.SetFinalStateHash(StateHash());
+    return _recording;
+}
+
+std::uint32_t Game::StateHash() const {
+    constexpr std::uint32_t kFnvPrime = 16777619u;
+    std::uint32_t hash = _map_ptr->ContentHash();
+    const auto mix = [&hash](std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= static_cast<std::uint32_t>((value >> (8 * i)) & 0xFFu);
+            hash *= kFnvPrime;
+        }
+    };
+
+    mix(_tick);
+    mix(static_cast<std::uint32_t>(score));
+    mix(static_cast<std::uint32_t>(player.GetX()));
+    mix(static_cast<std::uint32_t>(player.GetY()));
+    mix(static_cast<std::uint32_t>(player.GetDirection()));
+    for (std::size_t id = 0; id < enemies.Size(); ++id) {
+        mix(static_cast<std::uint32_t>(enemies.GetX(id)));
+        mix(static_cast<std::uint32_t>(enemies.GetY(id)));
+        mix(static_cast<std::uint32_t>(enemies.GetDirection(id)));
+        mix(enemies.IsAlive(id) ? 1u : 0u);
+    }
+    for (std::size_t id = 0; id < projectiles.Capacity(); ++id) {
+        if (projectiles.IsActive(id)) {
+            mix(static_cast<std::uint32_t>(projectiles.GetX(id)));
+            mix(static_cast<std::uint32_t>(projectiles.GetY(id)));
+        }
+    }
+    return hash;
+}
+
+void Game::Update(const PlayerInput& input) {
+    if (_recording_enabled) {
+        _recording.Append(input);
+    }
+    ++_tick;
+    ApplyInput(input);
+    projectiles.Update();
+    _visibility.Sync(*_map_ptr);
+
+    player.SnapshotPosition();
+
+    if (player.IsMoving()) {
+        player.Move();
+    }
+    // Enemies share one distance field toward where the player was last seen.
+    const GameMap::CellCoord player_cell{(player.GetY() + _grid_size / 2) / _grid_size,
+                                         (player.GetX() + _grid_size / 2) / _grid_size};
+    const GameMap::CellCoord target =
+        EnemySeesPlayer(player_cell) ? player_cell : _aiCentral->LastKnownPlayerCell();
+    _aiCentral->UpdatePlayerCell(*_map_ptr, target.row, target.col);
+    // Large enemy counts are split across the persistent pool; small ones stay on this thread.
+    enemies.Update(_workers);
+    ResolveCollisions();
+}
+
+void Game::ResolveCollisions() {
+    _enemy_grid.Begin(enemies.Size());
+    for (std::size_t id = 0; id < enemies.Size(); ++id) {
+        if (enemies.IsAlive(id)) {
+            _enemy_grid.Insert(id, enemies.GetX(id), enemies.GetY(id));
         }
+    }
+    _enemy_grid.Finish();
 
-        if (frame_duration < target_frame_duration) {
-            SDL_DelayNS((target_frame_duration - frame_duration) * 1000000);
+    // Projectiles are subtile-sized squares around their centre.
+    const int projectile_size = std::max(1, _grid_size / GameMap::kSubtilesPerAxis);
+    for (std::size_t shot = 0; shot < projectiles.Capacity(); ++shot) {
+        if (!projectiles.IsActive(shot)) {
+            continue;
         }
+        _enemy_grid.ForEachOverlap(projectiles.GetX(shot) - projectile_size / 2,
+                                   projectiles.GetY(shot) - projectile_size / 2, projectile_size,
+                                   projectile_size, [&](std::size_t id) {
+                                       if (!enemies.IsAlive(id)) {
+                                           return false;
+                                       }
+                                       enemies.Kill(id);
+                                       projectiles.Release(shot);
+                                       ++score;
+                                       return true;
+                                   });
+    }
+
+    _player_contacts = 0;
+    _enemy_grid.ForEachOverlap(player.GetX(), player.GetY(), _grid_size, _grid_size,
+                               [&](std::size_t id) {
+                                   _player_contacts += enemies.IsAlive(id) ? 1 : 0;
+                                   return false;
+                               });
+}
+
+bool Game::EnemySeesPlayer(GameMap::CellCoord player_cell) {
+    // One cached view from the player's cell answers the query for every enemy.
+    for (std::size_t id = 0; id < enemies.Size(); ++id) {
+        if (!enemies.IsAlive(id)) {
+            continue;
+        }
+        const GameMap::CellCoord enemy_cell{(enemies.GetY(id) + _grid_size / 2) / _grid_size,
+                                            (enemies.GetX(id) + _grid_size / 2) / _grid_size};
+        if (_visibility.IsVisible(*_map_ptr, player_cell, enemy_cell)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Game::ApplyInput(const PlayerInput& input) {
+    if (input.fire) {
+        projectiles.Spawn(player.GetX() + _grid_size / 2, player.GetY() + _grid_size / 2,
+                          player.GetDirection(), PROJECTILE_SPEED);
+    }
+
+    if (input.pause) {
+        return;
+    }
+
+    if (input.direction == Character::Direction::kNone) {
+        player.IsMoving(false);
+        return;
+    }
+
+    if (player.GetDirection() != input.direction) {
+        player.IsMoving(false);
+        player.SetDirection(input.direction);
+    } else {
+        player.IsMoving(true);
     }
 }
 
@@ -2,36 +2,104 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <random>
 
 #include "AICentral.h"
 #include "character.h"
-#include "controller.h"
-#include "enemy.h"
-#include "projectile.h"
-#include "renderer.h"
+#include "enemy_store.h"
+#include "input_recording.h"
+#include "player.h"
+#include "player_input.h"
+#include "projectile_pool.h"
+#include "spatial_grid.h"
+#include "visibility.h"
+#include "worker_pool.h"
+
+class Controller;
+class Renderer;
 
 class Game {
    public:
     Game(int grid_size, int grid_width, int grid_height, std::shared_ptr<GameMap> map_ptr,
-         std::shared_ptr<AICentral> aiCentral);
+         std::shared_ptr<AICentral> aiCentral, std::uint32_t seed, int enemy_count,
+         int worker_threads);
+
+#ifndef PLAYGAME_HEADLESS
+    // When `replay` is given, its inputs drive the player instead of the controller and the loop
+    // ends once the recording is exhausted. The controller is still polled so the window can close.
+    void Run(Controller const& controller, Renderer& renderer, std::size_t target_frame_duration,
+             std::size_t tick_rate, const InputRecording* replay = nullptr);
+#endif
 
-    void Run(Controller const& controller, Renderer& renderer, std::size_t target_frame_duration);
+    // Advances the simulation by exactly one fixed tick using `input` for the player.
+    void Update(const PlayerInput& input);
 
     int GetScore() const;
 
+    std::uint64_t GetTick() const { return _tick; }
+
+    // Starts logging every tick's input. Must be called before the first Update() so the map
+    // hash stored in the recording matches the map the replay starts from. `map_index` is the
+    // maps.db record the map was loaded from and is stored so the replay loads the same one.
+    void StartRecording(int map_index);
+
+    // Stamps the recording with the current StateHash() so a replay can verify it ends identically.
+    const InputRecording& FinishRecording();
+
+    // Hash of the map contents, character positions/directions, enemy liveness, score and tick
+    // count.
+    std::uint32_t StateHash() const;
+
+    std::uint32_t GetSeed() const { return _seed; }
+
+    // Threads sharing the enemy update, including the one calling Update().
+    std::size_t GetThreadCount() const { return _workers.ThreadCount() + 1; }
+
+    const Player& GetPlayer() const { return player; }
+
+    const EnemyStore& GetEnemies() const { return enemies; }
+
+    const ProjectilePool& GetProjectiles() const { return projectiles; }
+
+    // Living enemies overlapping the player after the latest tick.
+    std::size_t GetPlayerContacts() const { return _player_contacts; }
+
    private:
+    void ApplyInput(const PlayerInput& input);
+
+    void SpawnEnemies(int count, int grid_width);
+
+    // Nearest walkable cell to (row, col), searched ring by ring; (row, col) itself if none.
+    GameMap::CellCoord FindSpawnCell(int row, int col) const;
+
+    // True if any living enemy has the player's cell in view.
+    bool EnemySeesPlayer(GameMap::CellCoord player_cell);
+
+    // Refiles living enemies in the broadphase grid, then lets projectiles kill the first
+    // enemy they overlap and counts enemies touching the player.
+    void ResolveCollisions();
+
+    // Declared before the characters so it is seeded before EnemyStore receives it.
+    std::uint32_t _seed;
+    std::shared_ptr<std::mt19937> _rng;
     Player player;
-    Enemy enemy;
+    EnemyStore enemies;
     std::shared_ptr<AICentral> _aiCentral;
-    // std::vector<Enemy> enemies;
-    // std::vector<Projectile> projectiles;
+    ProjectilePool projectiles;
 
     std::shared_ptr<GameMap> _map_ptr;
     int _grid_size;
     int score{0};
+    std::uint64_t _tick{0};
+    bool _recording_enabled{false};
+    InputRecording _recording;
+    WorkerPool _workers;
+    Visibility _visibility;
+    SpatialGrid _enemy_grid;
+    std::size_t _player_contacts{0};
 };
 
-#endif
\ No newline at end of file
+#endif
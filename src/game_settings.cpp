@@ -0,0 +1,110 @@
+#include "game_settings.h"
+#include <iostream>
+#include <random>
+#include "../shared/config/config_manager.h"
+#include "../shared/error_handler/error_handler.h"
+#include "constants.h"
+#include "path_resolver.h"
+
+namespace {
+int positive_or_default(int value, int fallback, const char* label) {
+    if (value > 0) {
+        return value;
+    }
+
+    std::cerr << "Warning: Invalid config value for " << label << " (" << value
+              << "), using default " << fallback << ".\n";
+    return fallback;
+}
+}  // namespace
+
+bool load_game_settings(GameSettings* settings) {
+    if (!settings) {
+        return false;
+    }
+
+    // Initialize configuration system
+    ConfigManager config;
+    if (!config_manager_init(&config, "Character Game")) {
+        ErrorHandler_Log();
+        return false;
+    }
+
+    // Register configuration entries with defaults
+    config_register_entry(&config, "display", "grid_size", CONFIG_TYPE_INT,
+                          config_make_int(GRID_SIZE), true);
+    config_register_entry(&config, "display", "grid_width", CONFIG_TYPE_INT,
+                          config_make_int(GRID_WIDTH), true);
+    config_register_entry(&config, "display", "grid_height", CONFIG_TYPE_INT,
+                          config_make_int(GRID_HEIGHT), true);
+    config_register_entry(&config, "performance", "target_fps", CONFIG_TYPE_INT,
+                          config_make_int(TARGET_FPS), true);
+    config_register_entry(&config, "performance", "ms_per_frame", CONFIG_TYPE_INT,
+                          config_make_int(MS_PER_FRAME), true);
+    config_register_entry(&config, "performance", "tick_rate", CONFIG_TYPE_INT,
+                          config_make_int(TICK_RATE), false);
+    config_register_entry(&config, "performance", "worker_threads", CONFIG_TYPE_INT,
+                          config_make_int(WORKER_THREADS), false);
+    config_register_entry(&config, "simulation", "seed", CONFIG_TYPE_INT, config_make_int(0),
+                          false);
+    config_register_entry(&config, "simulation", "enemy_count", CONFIG_TYPE_INT,
+                          config_make_int(ENEMY_COUNT), false);
+    config_register_entry(&config, "files", "map_file", CONFIG_TYPE_STRING,
+                          config_make_string("game.map"), false);
+    config_register_entry(&config, "files", "map_index", CONFIG_TYPE_INT, config_make_int(0),
+                          false);
+
+    // Load configuration file
+    settings->config_path = resolve_game_config_path();
+    if (!config_manager_load(&config, settings->config_path.c_str())) {
+        std::cerr << "Warning: Failed to load configuration file, using defaults\n";
+        ErrorHandler_Log();
+        ErrorHandler_Clear();  // Clear error to allow execution with defaults
+    }
+
+    // Get configuration values
+    settings->grid_size =
+        positive_or_default(config_get_int(&config, "display", "grid_size", GRID_SIZE), GRID_SIZE,
+                            "display.grid_size");
+    settings->grid_width = positive_or_default(
+        config_get_int(&config, "display", "grid_width", GRID_WIDTH), GRID_WIDTH,
+        "display.grid_width");
+    settings->grid_height = positive_or_default(
+        config_get_int(&config, "display", "grid_height", GRID_HEIGHT), GRID_HEIGHT,
+        "display.grid_height");
+    settings->target_fps = positive_or_default(
+        config_get_int(&config, "performance", "target_fps", TARGET_FPS), TARGET_FPS,
+        "performance.target_fps");
+    settings->ms_per_frame = positive_or_default(
+        config_get_int(&config, "performance", "ms_per_frame", MS_PER_FRAME), MS_PER_FRAME,
+        "performance.ms_per_frame");
+    settings->tick_rate = positive_or_default(
+        config_get_int(&config, "performance", "tick_rate", TICK_RATE), TICK_RATE,
+        "performance.tick_rate");
+    settings->worker_threads =
+        config_get_int(&config, "performance", "worker_threads", WORKER_THREADS);
+    if (settings->worker_threads < 0) {
+        std::cerr << "Warning: Invalid config value for performance.worker_threads ("
+                  << settings->worker_threads << "), using default " << WORKER_THREADS << ".\n";
+        settings->worker_threads = WORKER_THREADS;
+    }
+    const int configured_seed = config_get_int(&config, "simulation", "seed", 0);
+    if (configured_seed != 0) {
+        settings->seed = static_cast<std::uint32_t>(configured_seed);
+    } else {
+        // No fixed seed configured: draw one, but report it so the run can be replayed.
+        settings->seed = std::random_device{}();
+    }
+    settings->enemy_count = positive_or_default(
+        config_get_int(&config, "simulation", "enemy_count", ENEMY_COUNT), ENEMY_COUNT,
+        "simulation.enemy_count");
+    const char* configured_map_file = config_get_string(&config, "files", "map_file", "game.map");
+    settings->map_path = resolve_game_map_path(configured_map_file);
+    settings->map_index = config_get_int(&config, "files", "map_index", 0);
+    if (settings->map_index < 0) {
+        std::cerr << "Warning: Invalid config value for files.map_index (" << settings->map_index
+                  << "), using default 0.\n";
+        settings->map_index = 0;
+    }
+    return true;
+}
@@ -0,0 +1,29 @@
+#ifndef GAME_SETTINGS_H
+#define GAME_SETTINGS_H
+
+#include <cstdint>
+#include <string>
+
+// Values read from config/game_config.json, shared by the windowed game and the headless runner.
+struct GameSettings {
+    std::string config_path;
+    std::string map_path;
+    // Map to load when map_path is a maps.db container; ignored for text maps.
+    int map_index;
+    int grid_size;
+    int grid_width;
+    int grid_height;
+    int target_fps;
+    int ms_per_frame;
+    int tick_rate;
+    std::uint32_t seed;
+    int enemy_count;
+    // Threads used to update enemies, including the calling one; 0 means one per hardware core.
+    int worker_threads;
+};
+
+// Loads settings, falling back to the defaults in constants.h for missing or invalid values.
+// Returns false only if the configuration system itself could not be initialized.
+bool load_game_settings(GameSettings* settings);
+
+#endif  // GAME_SETTINGS_H
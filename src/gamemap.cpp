@@ -1,49 +1,117 @@
 #include "gamemap.h"
+#include <algorithm>
+#include <charconv>
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
-#include <sstream>
+#include <iostream>
+#include <limits>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
+#include "../shared/map_db/map_db.h"
+#include "../shared/utilities/file_utils.h"
 #include "tempmap.h"
 
 namespace {
 constexpr int kSubtilesPerCell = GameMap::kSubtilesPerCell;
 constexpr int kSubtilesPerAxis = GameMap::kSubtilesPerAxis;
-constexpr std::streamoff kMapDataOffset = 64;
+constexpr std::size_t kMapDataOffset = 64;
 constexpr std::uint8_t kHealthMask = 0x07u;
 constexpr int kDestructionShift = 3;
 constexpr std::uint8_t kDestructionMask = 0x07u;
 constexpr int kMovementShift = 6;
 constexpr std::uint8_t kMovementMask = 0x03u;
+constexpr std::uint32_t kFnvOffsetBasis = 2166136261u;
+constexpr std::uint32_t kFnvPrime = 16777619u;
 
-bool parse_int(const std::string& token, int* out_value) {
+bool host_is_little_endian() {
+    const std::uint16_t probe = 1;
+    std::uint8_t first_byte = 0;
+    std::memcpy(&first_byte, &probe, 1);
+    return first_byte == 1;
+}
+
+// Splits like std::getline: yields the text up to the next `delimiter`, and no trailing empty
+// field after a final delimiter.
+bool next_field(std::string_view* rest, char delimiter, std::string_view* out_field) {
+    if (rest->empty()) {
+        return false;
+    }
+
+    const std::size_t end = rest->find(delimiter);
+    *out_field = rest->substr(0, end);
+    rest->remove_prefix(end == std::string_view::npos ? rest->size() : end + 1);
+    return true;
+}
+
+// Accepts what strtol(token, &end, 10) consumes entirely: an optional sign and decimal digits.
+// Out-of-range values saturate like strtol before narrowing.
+bool parse_int(std::string_view token, int* out_value) {
     if (!out_value || token.empty()) {
         return false;
     }
 
-    char* end_ptr = nullptr;
-    const long parsed = std::strtol(token.c_str(), &end_ptr, 10);
-    if (end_ptr == token.c_str() || *end_ptr != '\0') {
+    bool negative = false;
+    if (token[0] == '+' || token[0] == '-') {
+        negative = token[0] == '-';
+        token.remove_prefix(1);
+    }
+    if (token.empty() || token[0] < '0' || token[0] > '9') {
+        return false;
+    }
+
+    long parsed = 0;
+    const char* end = token.data() + token.size();
+    const std::from_chars_result result = std::from_chars(token.data(), end, parsed);
+    if (result.ptr != end) {
         return false;
     }
+    if (result.ec == std::errc::result_out_of_range) {
+        parsed = negative ? std::numeric_limits<long>::min() : std::numeric_limits<long>::max();
+    } else if (negative) {
+        parsed = -parsed;
+    }
 
     *out_value = static_cast<int>(parsed);
     return true;
 }
 
-bool parse_uint16_auto(const std::string& token, std::uint16_t* out_value) {
+// Accepts what strtoul(token, &end, 0) consumes entirely (decimal, 0x-prefixed hex or
+// 0-prefixed octal, optional sign) when the value fits in 16 bits.
+bool parse_uint16_auto(std::string_view token, std::uint16_t* out_value) {
     if (!out_value || token.empty()) {
         return false;
     }
 
-    char* end_ptr = nullptr;
-    const unsigned long parsed = std::strtoul(token.c_str(), &end_ptr, 0);
-    if (end_ptr == token.c_str() || *end_ptr != '\0') {
+    bool negative = false;
+    if (token[0] == '+' || token[0] == '-') {
+        negative = token[0] == '-';
+        token.remove_prefix(1);
+    }
+
+    int base = 10;
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+        base = 16;
+        token.remove_prefix(2);
+    } else if (token.size() > 1 && token[0] == '0') {
+        base = 8;
+        token.remove_prefix(1);
+    }
+    if (token.empty() || token[0] == '+' || token[0] == '-') {
         return false;
     }
-    if (parsed > 65535ul) {
+
+    unsigned long parsed = 0;
+    const char* end = token.data() + token.size();
+    const std::from_chars_result result = std::from_chars(token.data(), end, parsed, base);
+    if (result.ptr != end || result.ec != std::errc()) {
+        return false;
+    }
+    // strtoul negates in unsigned arithmetic, so only "-0" stays in range.
+    if (parsed > 65535ul || (negative && parsed != 0)) {
         return false;
     }
 
@@ -51,16 +119,6 @@ bool parse_uint16_auto(const std::string& token, std::uint16_t* out_value) {
     return true;
 }
 
-std::vector<std::string> split(const std::string& input, char delimiter) {
-    std::vector<std::string> parts;
-    std::stringstream ss(input);
-    std::string item;
-    while (std::getline(ss, item, delimiter)) {
-        parts.push_back(item);
-    }
-    return parts;
-}
-
 std::uint8_t subtile_spec(std::uint16_t entry) {
     return static_cast<std::uint8_t>((entry >> 8) & 0xFFu);
 }
@@ -99,15 +157,15 @@ std::uint16_t set_subtile_health(std::uint16_t entry, std::uint8_t health) {
     return static_cast<std::uint16_t>(tile_id | (static_cast<std::uint16_t>(updated_spec) << 8));
 }
 
-bool parse_csv_uint8_16(const std::string& csv, std::array<std::uint8_t, kSubtilesPerCell>* out_ids) {
+bool parse_csv_uint8_16(std::string_view csv,
+                        std::array<std::uint8_t, kSubtilesPerCell>* out_ids) {
     if (!out_ids) {
         return false;
     }
 
-    std::stringstream subtile_stream(csv);
-    std::string subtile_token;
+    std::string_view subtile_token;
     int subtile_index = 0;
-    while (std::getline(subtile_stream, subtile_token, ',')) {
+    while (next_field(&csv, ',', &subtile_token)) {
         if (subtile_index >= kSubtilesPerCell) {
             return false;
         }
@@ -126,16 +184,15 @@ bool parse_csv_uint8_16(const std::string& csv, std::array<std::uint8_t, kSubtil
     return subtile_index == kSubtilesPerCell;
 }
 
-bool parse_csv_uint16_16(const std::string& csv,
+bool parse_csv_uint16_16(std::string_view csv,
                          std::array<std::uint16_t, kSubtilesPerCell>* out_entries) {
     if (!out_entries) {
         return false;
     }
 
-    std::stringstream entry_stream(csv);
-    std::string entry_token;
+    std::string_view entry_token;
     int entry_index = 0;
-    while (std::getline(entry_stream, entry_token, ',')) {
+    while (next_field(&csv, ',', &entry_token)) {
         if (entry_index >= kSubtilesPerCell) {
             return false;
         }
@@ -172,26 +229,33 @@ GameMap::MapCell make_legacy_cell(int value) {
     return cell;
 }
 
-void ensure_default_destructible_subtiles(GameMap::MapCell* cell) {
-    if (!cell || cell->has_subtiles || cell->material == 0) {
-        return;
-    }
+std::uint16_t default_destructible_entry() {
+    return make_subtile_entry(0, 1, GameMap::kDestructionNormal, GameMap::kMovementNoPass);
+}
 
-    const std::uint16_t default_entry = make_subtile_entry(
-        0, 1, GameMap::kDestructionNormal, GameMap::kMovementNoPass);
-    cell->subtiles.fill(default_entry);
-    cell->has_subtiles = true;
+// Splits a cell token into exactly `count` '|'-separated parts.
+template <std::size_t N>
+bool split_cell_token(std::string_view token, std::array<std::string_view, N>* out_parts) {
+    std::string_view part;
+    std::size_t count = 0;
+    while (next_field(&token, '|', &part)) {
+        if (count == N) {
+            return false;
+        }
+        (*out_parts)[count++] = part;
+    }
+    return count == N;
 }
 
-bool parse_legacy_extended_cell_token(const std::string& token, GameMap::MapCell* out_cell) {
+bool parse_legacy_extended_cell_token(std::string_view token, GameMap::MapCell* out_cell) {
     if (!out_cell) {
         return false;
     }
 
     // Legacy extended token format:
     //   material|t0,t1,...,t15|destroyed_mask
-    const std::vector<std::string> parts = split(token, '|');
-    if (parts.size() != 3) {
+    std::array<std::string_view, 3> parts;
+    if (!split_cell_token(token, &parts)) {
         return false;
     }
     int material = 0;
@@ -223,7 +287,7 @@ bool parse_legacy_extended_cell_token(const std::string& token, GameMap::MapCell
     return true;
 }
 
-bool parse_packed_cell_token(const std::string& token, GameMap::MapCell* out_cell) {
+bool parse_packed_cell_token(std::string_view token, GameMap::MapCell* out_cell) {
     if (!out_cell) {
         return false;
     }
@@ -232,8 +296,8 @@ bool parse_packed_cell_token(const std::string& token, GameMap::MapCell* out_cel
     //   material|e0,e1,...,e15
     // each eN is uint16 (decimal or 0x-prefixed hex):
     //   low byte: tile_id, high byte: spec
-    const std::vector<std::string> parts = split(token, '|');
-    if (parts.size() != 2) {
+    std::array<std::string_view, 2> parts;
+    if (!split_cell_token(token, &parts)) {
         return false;
     }
 
@@ -252,28 +316,89 @@ bool parse_packed_cell_token(const std::string& token, GameMap::MapCell* out_cel
     out_cell->subtiles = entries;
     return true;
 }
+
+GameMap::MapCell parse_cell_token(std::string_view token) {
+    GameMap::MapCell cell;
+    if (token.find('|') != std::string_view::npos) {
+        if (!parse_packed_cell_token(token, &cell) &&
+            !parse_legacy_extended_cell_token(token, &cell)) {
+            // If parsing fails, preserve legacy behavior and treat the token as blocked.
+            cell = make_legacy_cell(1);
+        }
+        return cell;
+    }
+
+    int legacy_value = 0;
+    if (!parse_int(token, &legacy_value)) {
+        legacy_value = 1;
+    }
+    return make_legacy_cell(legacy_value);
+}
+
+bool is_token_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// Single pass over the raw text payload: one row per line with at least one token, tokens
+// separated by whitespace. Tokens are views into `text`; only the rows allocate.
+void parse_map_text(std::string_view text, std::vector<std::vector<GameMap::MapCell>>* rows) {
+    std::string_view line;
+    std::size_t last_width = 0;
+    while (next_field(&text, '\n', &line)) {
+        std::vector<GameMap::MapCell> row;
+        std::size_t pos = 0;
+        while (true) {
+            while (pos < line.size() && is_token_space(line[pos])) {
+                ++pos;
+            }
+            if (pos == line.size()) {
+                break;
+            }
+
+            std::size_t end = pos;
+            while (end < line.size() && !is_token_space(line[end])) {
+                ++end;
+            }
+            if (row.empty()) {
+                row.reserve(last_width);
+            }
+            row.push_back(parse_cell_token(line.substr(pos, end - pos)));
+            pos = end;
+        }
+
+        if (!row.empty()) {
+            last_width = row.size();
+            rows->emplace_back(std::move(row));
+        }
+    }
+}
+
+// Maps `path` read-only, or reads it into a heap buffer when it cannot be mapped. Either way
+// the returned owner releases the contents; it is null for a missing or empty file.
+std::shared_ptr<void> load_file(const std::string& path, std::size_t* size) {
+    if (void* view = file_map_readonly(path.c_str(), size)) {
+        const std::size_t mapped_size = *size;
+        return std::shared_ptr<void>(view, [mapped_size](void* data) {
+            file_unmap(data, mapped_size);
+        });
+    }
+    return std::shared_ptr<void>(file_read_all(path.c_str(), size), &std::free);
+}
 }  // namespace
 
 int GameMap::RowCount() const {
-    return static_cast<int>(_cells.size());
+    return _rows;
 }
 
 int GameMap::ColCount() const {
-    if (_cells.empty()) {
-        return 0;
-    }
-
-    return static_cast<int>(_cells.front().size());
+    return _cols;
 }
 
 bool GameMap::IsInBounds(int row, int col) const {
     if (row < 0 || col < 0) {
         return false;
     }
-    if (row >= static_cast<int>(_cells.size())) {
-        return false;
-    }
-    if (col >= static_cast<int>(_cells[row].size())) {
+    if (row >= _rows || col >= _cols) {
         return false;
     }
 
@@ -281,29 +406,15 @@ bool GameMap::IsInBounds(int row, int col) const {
 }
 
 bool GameMap::AreaIsAvailable(int row, int col) const {
-    if (_cells.empty()) {
-        return false;
-    }
     if (!IsInBounds(row, col)) {
         return false;
     }
 
-    const MapCell& cell = _cells[row][col];
-    if (!cell.has_subtiles) {
-        return cell.material == 0;
-    }
-
-    for (std::uint16_t entry : cell.subtiles) {
-        if (!subtile_is_walkable(entry)) {
-            return false;
-        }
-    }
-
-    return true;
+    return _walkable[CellIndex(row, col)];
 }
 
 int GameMap::GetElement(int row, int col) const {
-    if (_cells.empty() || !IsInBounds(row, col)) {
+    if (!IsInBounds(row, col)) {
         // Treat out-of-bounds as blocked to prevent undefined access.
         return 1;
     }
@@ -315,17 +426,8 @@ bool GameMap::MatchesDimensions(int expected_rows, int expected_cols) const {
     if (expected_rows <= 0 || expected_cols <= 0) {
         return false;
     }
-    if (RowCount() != expected_rows) {
-        return false;
-    }
 
-    for (const auto& row : _cells) {
-        if (static_cast<int>(row.size()) != expected_cols) {
-            return false;
-        }
-    }
-
-    return true;
+    return _uniform_rows && _rows == expected_rows && _cols == expected_cols;
 }
 
 int GameMap::GetCellMaterial(int row, int col) const {
@@ -333,7 +435,7 @@ int GameMap::GetCellMaterial(int row, int col) const {
         return 1;
     }
 
-    return _cells[row][col].material;
+    return _materials[CellIndex(row, col)];
 }
 
 bool GameMap::HasDestructibleSubtiles(int row, int col) const {
@@ -341,7 +443,7 @@ bool GameMap::HasDestructibleSubtiles(int row, int col) const {
         return false;
     }
 
-    return _cells[row][col].has_subtiles;
+    return _has_subtiles[CellIndex(row, col)];
 }
 
 std::uint8_t GameMap::GetSubtileId(int row, int col, int subtile_index) const {
@@ -351,11 +453,11 @@ std::uint8_t GameMap::GetSubtileId(int row, int col, int subtile_index) const {
     if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
         return 0;
     }
-    if (!_cells[row][col].has_subtiles) {
+    if (!_has_subtiles[CellIndex(row, col)]) {
         return 0;
     }
 
-    return subtile_tile_id(_cells[row][col].subtiles[subtile_index]);
+    return subtile_tile_id(CellSubtiles(row, col)[subtile_index]);
 }
 
 std::uint8_t GameMap::GetSubtileHealth(int row, int col, int subtile_index) const {
@@ -365,11 +467,11 @@ std::uint8_t GameMap::GetSubtileHealth(int row, int col, int subtile_index) cons
     if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
         return 0;
     }
-    if (!_cells[row][col].has_subtiles) {
+    if (!_has_subtiles[CellIndex(row, col)]) {
         return 0;
     }
 
-    return subtile_health_from_spec(subtile_spec(_cells[row][col].subtiles[subtile_index]));
+    return subtile_health_from_spec(subtile_spec(CellSubtiles(row, col)[subtile_index]));
 }
 
 std::uint8_t GameMap::GetSubtileDestructionMode(int row, int col, int subtile_index) const {
@@ -379,11 +481,11 @@ std::uint8_t GameMap::GetSubtileDestructionMode(int row, int col, int subtile_in
     if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
         return 0;
     }
-    if (!_cells[row][col].has_subtiles) {
+    if (!_has_subtiles[CellIndex(row, col)]) {
         return 0;
     }
 
-    return subtile_destruction_mode_from_spec(subtile_spec(_cells[row][col].subtiles[subtile_index]));
+    return subtile_destruction_mode_from_spec(subtile_spec(CellSubtiles(row, col)[subtile_index]));
 }
 
 std::uint8_t GameMap::GetSubtileMovement(int row, int col, int subtile_index) const {
@@ -393,11 +495,11 @@ std::uint8_t GameMap::GetSubtileMovement(int row, int col, int subtile_index) co
     if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
         return 0;
     }
-    if (!_cells[row][col].has_subtiles) {
+    if (!_has_subtiles[CellIndex(row, col)]) {
         return 0;
     }
 
-    return subtile_movement_from_spec(subtile_spec(_cells[row][col].subtiles[subtile_index]));
+    return subtile_movement_from_spec(subtile_spec(CellSubtiles(row, col)[subtile_index]));
 }
 
 bool GameMap::IsSubtileDestroyed(int row, int col, int subtile_index) const {
@@ -407,13 +509,64 @@ bool GameMap::IsSubtileDestroyed(int row, int col, int subtile_index) const {
     if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
         return false;
     }
-    if (!_cells[row][col].has_subtiles) {
+    if (!_has_subtiles[CellIndex(row, col)]) {
         return false;
     }
 
     return GetSubtileHealth(row, col, subtile_index) == 0;
 }
 
+std::uint16_t GameMap::GetSubtileWalkMask(int row, int col) const {
+    if (!IsInBounds(row, col)) {
+        return 0;
+    }
+
+    return _walk_masks[CellIndex(row, col)];
+}
+
+bool GameMap::IsSubtileWalkable(int row, int col, int subtile_index) const {
+    if (!IsInBounds(row, col)) {
+        return false;
+    }
+    if (subtile_index < 0 || subtile_index >= kSubtilesPerCell) {
+        return false;
+    }
+
+    return (_walk_masks[CellIndex(row, col)] & (1u << subtile_index)) != 0;
+}
+
+void GameMap::RefreshWalkability(int row, int col) {
+    const int index = CellIndex(row, col);
+    std::uint16_t mask = 0;
+    if (!_has_subtiles[index]) {
+        mask = (_materials[index] == 0) ? kAllSubtilesWalkable : 0;
+    } else {
+        const std::uint16_t* subtiles = CellSubtiles(row, col);
+        for (int i = 0; i < kSubtilesPerCell; ++i) {
+            if (subtile_is_walkable(subtiles[i])) {
+                mask = static_cast<std::uint16_t>(mask | (1u << i));
+            }
+        }
+    }
+
+    _walk_masks[index] = mask;
+    _walkable[index] = (mask == kAllSubtilesWalkable);
+}
+
+void GameMap::UpgradeLegacyCell(int row, int col) {
+    const int index = CellIndex(row, col);
+    if (_has_subtiles[index] || _materials[index] == 0) {
+        return;
+    }
+
+    std::uint16_t* subtiles = MutableCellSubtiles(row, col);
+    const std::uint16_t default_entry = default_destructible_entry();
+    for (int i = 0; i < kSubtilesPerCell; ++i) {
+        subtiles[i] = default_entry;
+    }
+    _has_subtiles[index] = true;
+}
+
 bool GameMap::DamageSubtile(int row, int col, int subtile_index) {
     if (!IsInBounds(row, col)) {
         return false;
@@ -422,20 +575,20 @@ bool GameMap::DamageSubtile(int row, int col, int subtile_index) {
         return false;
     }
 
-    MapCell& cell = _cells[row][col];
-    if (cell.material == 0 && !cell.has_subtiles) {
+    const int index = CellIndex(row, col);
+    if (_materials[index] == 0 && !_has_subtiles[index]) {
         return false;
     }
 
-    if (!cell.has_subtiles) {
+    if (!_has_subtiles[index]) {
         // Upgrade legacy blocked cells on demand so gameplay systems can still apply damage.
-        ensure_default_destructible_subtiles(&cell);
-        if (!cell.has_subtiles) {
+        UpgradeLegacyCell(row, col);
+        if (!_has_subtiles[index]) {
             return false;
         }
     }
 
-    const std::uint16_t entry = cell.subtiles[subtile_index];
+    const std::uint16_t entry = CellSubtiles(row, col)[subtile_index];
     const std::uint8_t spec = subtile_spec(entry);
     const std::uint8_t health = subtile_health_from_spec(spec);
     if (health == 0) {
@@ -447,7 +600,58 @@ bool GameMap::DamageSubtile(int row, int col, int subtile_index) {
         return false;
     }
 
-    cell.subtiles[subtile_index] = set_subtile_health(entry, static_cast<std::uint8_t>(health - 1));
+    MutableCellSubtiles(row, col)[subtile_index] =
+        set_subtile_health(entry, static_cast<std::uint8_t>(health - 1));
+    RefreshWalkability(row, col);
+    MarkCellChanged(row, col);
+    return true;
+}
+
+std::uint32_t GameMap::ContentHash() const {
+    std::uint32_t hash = kFnvOffsetBasis;
+    const auto mix = [&hash](std::uint32_t value, int byte_count) {
+        for (int i = 0; i < byte_count; ++i) {
+            hash ^= (value >> (8 * i)) & 0xFFu;
+            hash *= kFnvPrime;
+        }
+    };
+
+    mix(static_cast<std::uint32_t>(_rows), 4);
+    mix(static_cast<std::uint32_t>(_cols), 4);
+    for (int row = 0; row < _rows; ++row) {
+        for (int col = 0; col < _cols; ++col) {
+            const int index = CellIndex(row, col);
+            mix(_materials[index], 1);
+            mix(_has_subtiles[index] ? 1u : 0u, 1);
+            if (!_has_subtiles[index]) {
+                continue;
+            }
+            const std::uint16_t* subtiles = CellSubtiles(row, col);
+            for (int i = 0; i < kSubtilesPerCell; ++i) {
+                mix(subtiles[i], 2);
+            }
+        }
+    }
+    return hash;
+}
+
+void GameMap::MarkCellChanged(int row, int col) {
+    _change_log[_revision % kChangeLogCapacity] = CellCoord{row, col};
+    ++_revision;
+}
+
+bool GameMap::CollectChangedCells(std::uint64_t since_revision,
+                                  std::vector<CellCoord>* out) const {
+    if (!out || since_revision > _revision) {
+        return false;
+    }
+    if (_revision - since_revision > kChangeLogCapacity) {
+        return false;
+    }
+
+    for (std::uint64_t revision = since_revision; revision < _revision; ++revision) {
+        out->push_back(_change_log[revision % kChangeLogCapacity]);
+    }
     return true;
 }
 
@@ -500,54 +704,189 @@ bool GameMap::DamageAtWorldPosition(int world_x, int world_y) {
     return DamageSubtile(row, col, subtile_index);
 }
 
-GameMap::GameMap(int grid_height, int grid_width, int grid_size, const std::string& map_path)
+GameMap::GameMap(int grid_height, int grid_width, int grid_size, const std::string& map_path,
+                 int map_index)
     : _height(grid_height), _width(grid_width), _size(grid_size) {
-    std::ifstream filestream(map_path, std::ios::binary);
-    if (filestream.is_open()) {
-        char magic[4] = {0};
-        filestream.read(magic, sizeof(magic));
-        const bool has_embedded_header =
-            filestream.gcount() == static_cast<std::streamsize>(sizeof(magic)) &&
-            std::memcmp(magic, "MMD1", sizeof(magic)) == 0;
-        filestream.clear();
-        filestream.seekg(has_embedded_header ? kMapDataOffset : 0, std::ios::beg);
-
-        std::string line;
-        while (std::getline(filestream, line)) {
-            std::istringstream ls(line);
-            std::vector<MapCell> row;
-            std::string token;
-            while (ls >> token) {
-                MapCell cell;
-                if (token.find('|') != std::string::npos) {
-                    if (!parse_packed_cell_token(token, &cell) &&
-                        !parse_legacy_extended_cell_token(token, &cell)) {
-                        // If parsing fails, preserve legacy behavior and treat the token as blocked.
-                        cell = make_legacy_cell(1);
-                    }
-                } else {
-                    int legacy_value = 0;
-                    if (!parse_int(token, &legacy_value)) {
-                        legacy_value = 1;
-                    }
-                    cell = make_legacy_cell(legacy_value);
-                }
-                row.push_back(cell);
-            }
+    // The file is mapped (or read) once; its magic decides how the same bytes are parsed.
+    std::size_t size = 0;
+    const std::shared_ptr<void> file = load_file(map_path, &size);
+    const char* data = static_cast<const char*>(file.get());
+    const bool has_magic = data && size >= 4;
+    const bool is_database = has_magic && map_db_has_magic(data, size);
+    if (is_database) {
+        if (LoadDatabase(file, size, map_index)) {
+            return;
+        }
+        std::cerr << "Warning: Failed to load map " << map_index << " from '" << map_path
+                  << "', using the built-in map.\n";
+    }
 
-            if (!row.empty()) {
-                _cells.emplace_back(std::move(row));
-            }
+    // A database that failed to load must not be reparsed as text.
+    if (!is_database && (data || file_exists(map_path.c_str()))) {
+        // A missing buffer here means an empty file, which parses as an empty map.
+        std::string_view text = data ? std::string_view(data, size) : std::string_view();
+        if (has_magic && std::memcmp(data, "MMD1", 4) == 0) {
+            text.remove_prefix(std::min(text.size(), kMapDataOffset));
         }
+
+        std::vector<std::vector<MapCell>> rows;
+        parse_map_text(text, &rows);
+        AssignCells(rows);
     } else {
-        _cells.reserve(tempgamemap.size());
+        std::vector<std::vector<MapCell>> rows;
+        rows.reserve(tempgamemap.size());
         for (const auto& legacy_row : tempgamemap) {
             std::vector<MapCell> row;
             row.reserve(legacy_row.size());
             for (int value : legacy_row) {
                 row.push_back(make_legacy_cell(value));
             }
-            _cells.emplace_back(std::move(row));
+            rows.emplace_back(std::move(row));
+        }
+        AssignCells(rows);
+    }
+}
+
+void GameMap::AssignCells(const std::vector<std::vector<MapCell>>& rows) {
+    _rows = static_cast<int>(rows.size());
+    _cols = 0;
+    _uniform_rows = true;
+    for (const auto& row : rows) {
+        const int width = static_cast<int>(row.size());
+        if (_cols != 0 && width != _cols) {
+            _uniform_rows = false;
+        }
+        if (width > _cols) {
+            _cols = width;
+        }
+    }
+
+    // Short rows are padded with blocked cells; MatchesDimensions() still rejects the map.
+    ResizePlanes(_rows, _cols, true);
+
+    for (int row = 0; row < _rows; ++row) {
+        const auto& source_row = rows[row];
+        for (int col = 0; col < static_cast<int>(source_row.size()); ++col) {
+            const MapCell& cell = source_row[col];
+            const int index = CellIndex(row, col);
+            _materials[index] = static_cast<std::uint8_t>(cell.material == 0 ? 0 : 1);
+            _has_subtiles[index] = cell.has_subtiles;
+            if (cell.has_subtiles) {
+                std::copy(cell.subtiles.begin(), cell.subtiles.end(),
+                          MutableCellSubtiles(row, col));
+            }
+            RefreshWalkability(row, col);
+        }
+    }
+}
+
+void GameMap::ResizePlanes(int rows, int cols, bool own_subtiles) {
+    _rows = rows;
+    _cols = cols;
+    const std::size_t cell_count = static_cast<std::size_t>(rows) * static_cast<std::size_t>(cols);
+    _materials.assign(cell_count, 1);
+    _has_subtiles.assign(cell_count, false);
+    if (own_subtiles) {
+        _subtiles.assign(cell_count * kSubtilesPerCell, 0);
+    } else {
+        std::vector<std::uint16_t>().swap(_subtiles);
+    }
+    _subtiles_mapped.assign(cell_count, !own_subtiles);
+    _mapped_subtiles = nullptr;
+    _database.reset();
+    _walk_masks.assign(cell_count, 0);
+    _walkable.assign(cell_count, false);
+}
+
+std::uint16_t* GameMap::MutableCellSubtiles(int row, int col) {
+    const std::size_t index = static_cast<std::size_t>(CellIndex(row, col));
+    if (_subtiles_mapped[index]) {
+        if (_subtiles.empty()) {
+            _subtiles.assign(_materials.size() * kSubtilesPerCell, 0);
+        }
+        const std::uint16_t* mapped = _mapped_subtiles + index * kMappedSubtileStride;
+        std::copy(mapped, mapped + kSubtilesPerCell, &_subtiles[index * kSubtilesPerCell]);
+        _subtiles_mapped[index] = false;
+    }
+    return &_subtiles[index * kSubtilesPerCell];
+}
+
+bool GameMap::LoadDatabase(const std::shared_ptr<void>& file, std::size_t size, int map_index) {
+    static_assert(kMappedSubtileStride * 2 == MAP_DB_GRID_CELL_SIZE,
+                  "mapped subtile stride must match the maps.db GRID cell size");
+    if (map_index < 0 || map_index > UINT16_MAX) {
+        return false;
+    }
+
+    // The database borrows the file contents, so closing it is not needed.
+    MapDb db;
+    if (!map_db_open_memory(&db, file.get(), size)) {
+        return false;
+    }
+
+    MapDbRecord record;
+    const std::uint8_t* grid = nullptr;
+    std::uint32_t grid_size = 0;
+    if (!map_db_open_record(&db, static_cast<std::uint16_t>(map_index), &record) ||
+        !map_db_find_chunk(&record, MAP_DB_CHUNK_GRID, &grid, &grid_size) ||
+        grid_size != static_cast<std::uint32_t>(record.width) * record.height *
+                          MAP_DB_GRID_CELL_SIZE) {
+        return false;
+    }
+
+    // Subtile entries are read in place when the on-disk layout matches memory: little-endian
+    // host and an aligned GRID payload (always true for files from map_db_encode()). Otherwise
+    // they are decoded into `_subtiles` as for text maps.
+    const bool read_in_place = host_is_little_endian() &&
+                               reinterpret_cast<std::uintptr_t>(grid) % alignof(std::uint16_t) == 0;
+    ResizePlanes(record.height, record.width, !read_in_place);
+    _uniform_rows = true;
+    if (read_in_place) {
+        _mapped_subtiles = reinterpret_cast<const std::uint16_t*>(grid + 2);
+        _database = file;
+    }
+
+    MapDbCell cell;
+    for (int row = 0; row < _rows; ++row) {
+        for (int col = 0; col < _cols; ++col) {
+            const int index = CellIndex(row, col);
+            const std::uint8_t* grid_cell =
+                grid + static_cast<std::size_t>(index) * MAP_DB_GRID_CELL_SIZE;
+            _materials[index] = static_cast<std::uint8_t>(grid_cell[0] == 0 ? 0 : 1);
+            _has_subtiles[index] = (grid_cell[1] & MAP_DB_CELL_HAS_SUBTILES) != 0;
+            if (_has_subtiles[index] && !read_in_place) {
+                map_db_read_grid_cell(grid, static_cast<std::size_t>(index), &cell);
+                std::copy(cell.subtiles, cell.subtiles + kSubtilesPerCell,
+                          MutableCellSubtiles(row, col));
+            }
+            RefreshWalkability(row, col);
+        }
+    }
+    return true;
+}
+
+bool GameMap::SaveDatabase(const std::string& path, const std::string& title) const {
+    if (!_uniform_rows || _rows <= 0 || _rows > MAP_DB_MAX_ROWS || _cols <= 0 ||
+        _cols > MAP_DB_MAX_COLS) {
+        return false;
+    }
+
+    // MapDbMap holds a full 32x20 grid; keep it off the stack.
+    auto map = std::make_unique<MapDbMap>();
+    std::strncpy(map->title, title.c_str(), MAP_DB_TITLE_SIZE);
+    map->width = static_cast<std::uint8_t>(_cols);
+    map->height = static_cast<std::uint8_t>(_rows);
+    for (int row = 0; row < _rows; ++row) {
+        for (int col = 0; col < _cols; ++col) {
+            const int index = CellIndex(row, col);
+            MapDbCell& cell = map->cells[index];
+            cell.material = _materials[index];
+            if (_has_subtiles[index]) {
+                cell.flags = MAP_DB_CELL_HAS_SUBTILES;
+                std::copy(CellSubtiles(row, col), CellSubtiles(row, col) + kSubtilesPerCell,
+                          cell.subtiles);
+            }
         }
     }
+    return map_db_write_file(path.c_str(), map.get(), 1);
 }
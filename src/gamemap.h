@@ -2,7 +2,9 @@
 #define GAMEMAP_H
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -18,6 +20,13 @@ class GameMap {
     static constexpr std::uint8_t kDestructionNormal = 1;
     static constexpr std::uint8_t kDestructionHeavy = 2;
     static constexpr std::uint8_t kDestructionSpecial = 3;
+    static constexpr std::uint16_t kAllSubtilesWalkable = 0xFFFFu;
+    static constexpr std::size_t kChangeLogCapacity = 1024;
+
+    struct CellCoord {
+        int row{0};
+        int col{0};
+    };
 
     struct MapCell {
         int material{0};  // 0 = floor, 1 = blocked
@@ -25,7 +34,10 @@ class GameMap {
         std::array<std::uint16_t, kSubtilesPerCell> subtiles{};
     };
 
-    GameMap(int grid_height, int grid_width, int grid_size, const std::string& map_path);
+    // `map_path` is either a text map (optionally behind the 64-byte MMD1 header) or a binary
+    // maps.db container, in which case the map at index `map_index` is loaded.
+    GameMap(int grid_height, int grid_width, int grid_size, const std::string& map_path,
+            int map_index);
 
     bool AreaIsAvailable(int row, int col) const;
 
@@ -53,6 +65,12 @@ class GameMap {
 
     bool IsSubtileDestroyed(int row, int col, int subtile_index) const;
 
+    // Bit N is set when subtile N of the cell can be walked through. Cells without
+    // subtiles report all-or-nothing based on their material.
+    std::uint16_t GetSubtileWalkMask(int row, int col) const;
+
+    bool IsSubtileWalkable(int row, int col, int subtile_index) const;
+
     bool DamageSubtile(int row, int col, int subtile_index);
 
     bool WorldToSubtile(int world_x, int world_y, int* out_row, int* out_col,
@@ -60,11 +78,81 @@ class GameMap {
 
     bool DamageAtWorldPosition(int world_x, int world_y);
 
+    // FNV-1a hash of the current cell contents. Identifies the map a recording was made on.
+    std::uint32_t ContentHash() const;
+
+    // Incremented every time a cell changes. Consumers that cache map-derived state remember
+    // the revision they last synced with and ask for the cells changed since then.
+    std::uint64_t Revision() const { return _revision; }
+
+    // Appends the cells changed after `since_revision` to `out` (duplicates possible).
+    // Returns false when the change log no longer reaches back that far; callers should then
+    // treat the whole map as changed.
+    bool CollectChangedCells(std::uint64_t since_revision, std::vector<CellCoord>* out) const;
+
+    // Writes the current cells as a single-map maps.db file.
+    bool SaveDatabase(const std::string& path, const std::string& title) const;
+
    private:
+    int CellIndex(int row, int col) const { return row * _cols + col; }
+
+    // uint16_t entries per GRID cell in a maps.db (a 34-byte cell: material, flags, subtiles).
+    static constexpr std::size_t kMappedSubtileStride = 17;
+
+    const std::uint16_t* CellSubtiles(int row, int col) const {
+        const std::size_t index = static_cast<std::size_t>(CellIndex(row, col));
+        if (_subtiles_mapped[index]) {
+            return _mapped_subtiles + index * kMappedSubtileStride;
+        }
+        return &_subtiles[index * kSubtilesPerCell];
+    }
+
+    // Copy-on-write: a cell still read from the mapped database is copied into `_subtiles`
+    // before its first mutation.
+    std::uint16_t* MutableCellSubtiles(int row, int col);
+
+    void AssignCells(const std::vector<std::vector<MapCell>>& rows);
+
+    // Loads record `map_index` from a maps.db image held by `file`, which is kept alive when
+    // subtiles are read in place.
+    bool LoadDatabase(const std::shared_ptr<void>& file, std::size_t size, int map_index);
+
+    void ResizePlanes(int rows, int cols, bool own_subtiles);
+
+    void UpgradeLegacyCell(int row, int col);
+
+    void RefreshWalkability(int row, int col);
+
+    void MarkCellChanged(int row, int col);
+
     int _height;
     int _width;
     int _size;
-    std::vector<std::vector<MapCell>> _cells;
+
+    // Row-major struct-of-arrays storage: one entry per cell (or per subtile for
+    // `_subtiles`), indexed by `CellIndex(row, col)`.
+    int _rows{0};
+    int _cols{0};
+    bool _uniform_rows{true};
+    std::vector<std::uint8_t> _materials;
+    std::vector<bool> _has_subtiles;
+    std::vector<std::uint16_t> _subtiles;
+
+    // Maps loaded from a maps.db read subtile entries in place from the memory-mapped GRID
+    // chunk; `_subtiles` is only allocated once a cell is first damaged. `_database` keeps the
+    // file contents (normally that mapping) alive, shared between copies of this map.
+    std::vector<bool> _subtiles_mapped;
+    const std::uint16_t* _mapped_subtiles{nullptr};
+    std::shared_ptr<void> _database;
+
+    // Collision caches derived from the planes above. Built at load time and refreshed
+    // per cell by DamageSubtile(), so movement queries are a single lookup.
+    std::vector<std::uint16_t> _walk_masks;
+    std::vector<bool> _walkable;
+
+    // Ring buffer of the last kChangeLogCapacity changed cells, keyed by revision.
+    std::uint64_t _revision{0};
+    std::array<CellCoord, kChangeLogCapacity> _change_log{};
 };
 
 #endif  // GAMEMAP_H
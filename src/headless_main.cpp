@@ -0,0 +1,328 @@
+// Headless simulation runner: steps Game without a window, renderer or SDL input, driven by
+// scripted player input, as fast as possible. Intended for soak tests on display-less machines.
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AICentral.h"
+#include "game.h"
+#include "game_settings.h"
+#include "gamemap.h"
+#include "input_recording.h"
+#include "player_input.h"
+
+namespace {
+constexpr int kDefaultTicks = 10000;
+
+struct ScriptStep {
+    int ticks;
+    PlayerInput input;
+};
+
+// Default script: sweep the player around in a square while firing periodically.
+std::vector<ScriptStep> default_script() {
+    std::vector<ScriptStep> steps;
+    const Character::Direction directions[] = {
+        Character::Direction::kUp, Character::Direction::kRight, Character::Direction::kDown,
+        Character::Direction::kLeft};
+    for (Character::Direction direction : directions) {
+        PlayerInput move;
+        move.direction = direction;
+        PlayerInput fire = move;
+        fire.fire = true;
+        steps.push_back({1, fire});
+        steps.push_back({59, move});
+    }
+    return steps;
+}
+
+bool parse_direction(char code, PlayerInput* input) {
+    switch (code) {
+        case 'U':
+            input->direction = Character::Direction::kUp;
+            return true;
+        case 'D':
+            input->direction = Character::Direction::kDown;
+            return true;
+        case 'L':
+            input->direction = Character::Direction::kLeft;
+            return true;
+        case 'R':
+            input->direction = Character::Direction::kRight;
+            return true;
+        case 'N':
+            input->direction = Character::Direction::kNone;
+            return true;
+        case 'P':
+            input->pause = true;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Script file format, one step per line, looped when exhausted:
+//   <ticks> <U|D|L|R|N|P> [F]
+// where `P` holds pause and a trailing `F` fires on the first tick of the step.
+// Empty lines and lines starting with '#' are ignored.
+bool load_script(const std::string& path, std::vector<ScriptStep>* steps) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream ls(line);
+        ScriptStep step{0, PlayerInput{}};
+        std::string code;
+        std::string fire;
+        if (!(ls >> step.ticks >> code) || step.ticks <= 0 || code.size() != 1 ||
+            !parse_direction(code[0], &step.input)) {
+            std::cerr << "Error: Invalid script line: " << line << "\n";
+            return false;
+        }
+        if (ls >> fire) {
+            if (fire != "F") {
+                std::cerr << "Error: Invalid script line: " << line << "\n";
+                return false;
+            }
+            step.input.fire = true;
+        }
+        steps->push_back(step);
+    }
+
+    return !steps->empty();
+}
+
+// Parses a whole non-negative decimal int; rejects empty, trailing text, negative and overflow.
+bool parse_count(const char* text, int* out_value) {
+    char* end = nullptr;
+    errno = 0;
+    const long value = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || value < 0 ||
+        value > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    *out_value = static_cast<int>(value);
+    return true;
+}
+
+// Title stored in an exported maps.db: the map file name without directory or extension.
+std::string map_title(const std::string& map_path) {
+    const std::size_t slash = map_path.find_last_of("/\\");
+    std::string title = slash == std::string::npos ? map_path : map_path.substr(slash + 1);
+    const std::size_t dot = title.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        title.erase(dot);
+    }
+    return title;
+}
+
+void print_usage() {
+    std::cout << "Usage: PlayGameHeadless [--ticks N] [--map PATH] [--map-index N]\n"
+                 "                        [--script PATH] [--seed N] [--enemies N] [--threads N]\n"
+                 "                        [--record PATH] [--replay PATH] [--export-db PATH]\n";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    int tick_count = kDefaultTicks;
+    std::string map_override;
+    std::string script_path;
+    std::string seed_override;
+    int enemy_override = -1;
+    int thread_override = -1;
+    int map_index_override = -1;
+    std::string record_path;
+    std::string replay_path;
+    std::string export_db_path;
+    bool ticks_given = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        int* count_target = nullptr;
+        if (arg == "--ticks") {
+            count_target = &tick_count;
+            ticks_given = true;
+        } else if (arg == "--map-index") {
+            count_target = &map_index_override;
+        } else if (arg == "--enemies") {
+            count_target = &enemy_override;
+        } else if (arg == "--threads") {
+            count_target = &thread_override;
+        }
+        if (count_target && has_value) {
+            if (!parse_count(argv[++i], count_target)) {
+                std::cerr << "Error: " << arg << " expects a non-negative integer, got '"
+                          << argv[i] << "'.\n";
+                return 1;
+            }
+        } else if (arg == "--map" && has_value) {
+            map_override = argv[++i];
+        } else if (arg == "--script" && has_value) {
+            script_path = argv[++i];
+        } else if (arg == "--seed" && has_value) {
+            seed_override = argv[++i];
+        } else if (arg == "--record" && has_value) {
+            record_path = argv[++i];
+        } else if (arg == "--replay" && has_value) {
+            replay_path = argv[++i];
+        } else if (arg == "--export-db" && has_value) {
+            export_db_path = argv[++i];
+        } else {
+            print_usage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (tick_count <= 0) {
+        std::cerr << "Error: --ticks must be positive.\n";
+        return 1;
+    }
+
+    GameSettings settings;
+    if (!load_game_settings(&settings)) {
+        return 1;
+    }
+    const std::string map_path = map_override.empty() ? settings.map_path : map_override;
+    if (enemy_override >= 0) {
+        settings.enemy_count = enemy_override;
+    }
+    if (map_index_override >= 0) {
+        settings.map_index = map_index_override;
+    }
+    if (thread_override >= 0) {
+        settings.worker_threads = thread_override;
+    }
+    if (!seed_override.empty()) {
+        settings.seed = static_cast<std::uint32_t>(std::strtoul(seed_override.c_str(), nullptr, 10));
+    }
+
+    InputRecording replay;
+    if (!replay_path.empty()) {
+        if (!replay.Load(replay_path)) {
+            return 1;
+        }
+        // The recording fixes everything the simulation depends on; the thread count is not part
+        // of that, so --threads still applies.
+        settings.seed = replay.Seed();
+        settings.enemy_count = replay.EnemyCount();
+        settings.map_index = replay.MapIndex();
+        if (!ticks_given) {
+            tick_count = static_cast<int>(replay.TickCount());
+        }
+    }
+
+    std::vector<ScriptStep> script;
+    if (script_path.empty()) {
+        script = default_script();
+    } else if (!load_script(script_path, &script)) {
+        std::cerr << "Error: Failed to load input script '" << script_path << "'.\n";
+        return 1;
+    }
+
+    std::shared_ptr<GameMap> map_ptr =
+        std::make_shared<GameMap>(settings.grid_height, settings.grid_width, settings.grid_size,
+                                  map_path, settings.map_index);
+    if (!map_ptr->MatchesDimensions(settings.grid_height, settings.grid_width)) {
+        std::cerr << "Error: Map dimensions do not match configured grid dimensions.\n";
+        std::cerr << "  Expected rows x cols: " << settings.grid_height << "x"
+                  << settings.grid_width << "\n";
+        std::cerr << "  Loaded rows x cols:   " << map_ptr->RowCount() << "x"
+                  << map_ptr->ColCount() << "\n";
+        return 1;
+    }
+    if (!replay_path.empty() && replay.MapHash() != map_ptr->ContentHash()) {
+        std::cerr << "Error: Replay '" << replay_path << "' was recorded on a different map.\n";
+        return 1;
+    }
+    if (!export_db_path.empty()) {
+        // Export the map as loaded, before the simulation damages it.
+        if (!map_ptr->SaveDatabase(export_db_path, map_title(map_path))) {
+            std::cerr << "Error: Failed to write map database '" << export_db_path << "'.\n";
+            return 1;
+        }
+        std::cout << "Exported map to: " << export_db_path << "\n";
+    }
+    std::shared_ptr<AICentral> aiCentral =
+        std::make_shared<AICentral>(map_ptr->RowCount(), map_ptr->ColCount());
+    Game game(settings.grid_size, settings.grid_width, settings.grid_height, map_ptr, aiCentral,
+              settings.seed, settings.enemy_count, settings.worker_threads);
+    if (!record_path.empty()) {
+        game.StartRecording(settings.map_index);
+    }
+
+    std::size_t step_index = 0;
+    int step_tick = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < tick_count; ++tick) {
+        if (!replay_path.empty()) {
+            game.Update(replay.At(static_cast<std::size_t>(tick)));
+            continue;
+        }
+
+        const ScriptStep& step = script[step_index];
+        PlayerInput input = step.input;
+        input.fire = step.input.fire && step_tick == 0;
+        game.Update(input);
+
+        if (++step_tick >= step.ticks) {
+            step_tick = 0;
+            step_index = (step_index + 1) % script.size();
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "Headless run complete\n";
+    std::cout << "  Map path: " << map_path << "\n";
+    std::cout << "  Seed: " << game.GetSeed() << "\n";
+    std::cout << "  Ticks: " << tick_count << "\n";
+    std::cout << "  Threads: " << game.GetThreadCount() << "\n";
+    std::cout << "  Elapsed: " << seconds << " s\n";
+    if (seconds > 0.0) {
+        std::cout << "  Ticks/sec: " << static_cast<double>(tick_count) / seconds << "\n";
+    }
+    std::cout << "  Player: " << game.GetPlayer().GetX() << "," << game.GetPlayer().GetY() << "\n";
+    const EnemyStore& enemies = game.GetEnemies();
+    std::cout << "  Enemies alive: " << enemies.AliveCount() << "/" << enemies.Size() << "\n";
+    if (enemies.Size() > 0) {
+        std::cout << "  Enemy 0: " << enemies.GetX(0) << "," << enemies.GetY(0) << "\n";
+    }
+    std::cout << "  Score: " << game.GetScore() << ", enemies touching player: "
+              << game.GetPlayerContacts() << "\n";
+    const ProjectilePool& projectiles = game.GetProjectiles();
+    std::cout << "  Projectiles in flight: " << projectiles.ActiveCount() << "/"
+              << projectiles.Capacity() << ", subtile hits: " << projectiles.HitCount() << "\n";
+    std::cout << "  AI explored cells: " << aiCentral->ExploredCount() << "/"
+              << map_ptr->RowCount() * map_ptr->ColCount() << "\n";
+    std::cout << "  Map revision: " << map_ptr->Revision() << "\n";
+    std::cout << "  Map hash: " << map_ptr->ContentHash() << "\n";
+    std::cout << "  State hash: " << game.StateHash() << "\n";
+
+    if (!record_path.empty()) {
+        if (!game.FinishRecording().Save(record_path)) {
+            return 1;
+        }
+        std::cout << "  Recorded to: " << record_path << "\n";
+    }
+
+    if (!replay_path.empty() && !ticks_given && replay.FinalStateHash() != 0 &&
+        replay.FinalStateHash() != game.StateHash()) {
+        std::cerr << "Error: Replay diverged; expected state hash " << replay.FinalStateHash()
+                  << ".\n";
+        return 1;
+    }
+    return 0;
+}
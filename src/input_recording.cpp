@@ -0,0 +1,125 @@
+#include "input_recording.h"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <iostream>
+#include "../shared/utilities/file_utils.h"
+
+namespace {
+constexpr char kMagic[4] = {'P', 'G', 'I', 'R'};
+constexpr std::uint16_t kVersion = 2;
+constexpr std::size_t kHeaderSize = 32;
+constexpr std::uint8_t kDirectionMask = 0x07u;
+constexpr std::uint8_t kFireBit = 0x08u;
+constexpr std::uint8_t kPauseBit = 0x10u;
+constexpr std::uint8_t kDirectionCount = static_cast<std::uint8_t>(Character::Direction::kNone) + 1;
+
+void write_u16(std::vector<std::uint8_t>* out, std::uint16_t value) {
+    out->push_back(static_cast<std::uint8_t>(value & 0xFFu));
+    out->push_back(static_cast<std::uint8_t>((value >> 8) & 0xFFu));
+}
+
+void write_u32(std::vector<std::uint8_t>* out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out->push_back(static_cast<std::uint8_t>((value >> (8 * i)) & 0xFFu));
+    }
+}
+
+std::uint16_t read_u16(const std::uint8_t* in) {
+    return static_cast<std::uint16_t>(in[0] | (in[1] << 8));
+}
+
+std::uint32_t read_u32(const std::uint8_t* in) {
+    return static_cast<std::uint32_t>(in[0]) | (static_cast<std::uint32_t>(in[1]) << 8) |
+           (static_cast<std::uint32_t>(in[2]) << 16) | (static_cast<std::uint32_t>(in[3]) << 24);
+}
+
+std::uint8_t encode_input(const PlayerInput& input) {
+    std::uint8_t code = static_cast<std::uint8_t>(input.direction) & kDirectionMask;
+    if (input.fire) {
+        code |= kFireBit;
+    }
+    if (input.pause) {
+        code |= kPauseBit;
+    }
+    return code;
+}
+
+PlayerInput decode_input(std::uint8_t code) {
+    PlayerInput input;
+    const std::uint8_t direction = code & kDirectionMask;
+    input.direction = direction < kDirectionCount ? static_cast<Character::Direction>(direction)
+                                                  : Character::Direction::kNone;
+    input.fire = (code & kFireBit) != 0;
+    input.pause = (code & kPauseBit) != 0;
+    return input;
+}
+}  // namespace
+
+InputRecording::InputRecording(std::uint32_t seed, std::uint32_t map_hash, int enemy_count,
+                               int map_index)
+    : _seed(seed), _map_hash(map_hash), _enemy_count(enemy_count), _map_index(map_index) {}
+
+void InputRecording::Append(const PlayerInput& input) {
+    _ticks.push_back(encode_input(input));
+}
+
+PlayerInput InputRecording::At(std::size_t tick) const {
+    if (tick >= _ticks.size()) {
+        return PlayerInput{};
+    }
+
+    return decode_input(_ticks[tick]);
+}
+
+bool InputRecording::Save(const std::string& path) const {
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(kHeaderSize + _ticks.size());
+    buffer.insert(buffer.end(), kMagic, kMagic + sizeof(kMagic));
+    write_u16(&buffer, kVersion);
+    write_u16(&buffer, 0);
+    write_u32(&buffer, _seed);
+    write_u32(&buffer, _map_hash);
+    write_u32(&buffer, static_cast<std::uint32_t>(_ticks.size()));
+    write_u32(&buffer, _final_state_hash);
+    write_u32(&buffer, static_cast<std::uint32_t>(_enemy_count));
+    write_u32(&buffer, static_cast<std::uint32_t>(_map_index));
+    buffer.insert(buffer.end(), _ticks.begin(), _ticks.end());
+
+    if (!file_write_atomic(path.c_str(), buffer.data(), buffer.size())) {
+        std::cerr << "Error: Failed to write input recording '" << path << "'.\n";
+        return false;
+    }
+    return true;
+}
+
+bool InputRecording::Load(const std::string& path) {
+    std::size_t size = 0;
+    std::uint8_t* data = static_cast<std::uint8_t*>(file_read_all(path.c_str(), &size));
+    if (!data) {
+        std::cerr << "Error: Failed to read input recording '" << path << "'.\n";
+        return false;
+    }
+
+    bool ok = size >= kHeaderSize && std::memcmp(data, kMagic, sizeof(kMagic)) == 0 &&
+              read_u16(data + 4) == kVersion;
+    constexpr std::uint32_t kMaxSetupValue = std::numeric_limits<int>::max();
+    const std::uint32_t tick_count = ok ? read_u32(data + 16) : 0;
+    const std::uint32_t enemy_count = ok ? read_u32(data + 24) : 0;
+    const std::uint32_t map_index = ok ? read_u32(data + 28) : 0;
+    ok = ok && size - kHeaderSize >= tick_count && enemy_count <= kMaxSetupValue &&
+         map_index <= kMaxSetupValue;
+    if (ok) {
+        _seed = read_u32(data + 8);
+        _map_hash = read_u32(data + 12);
+        _final_state_hash = read_u32(data + 20);
+        _enemy_count = static_cast<int>(enemy_count);
+        _map_index = static_cast<int>(map_index);
+        _ticks.assign(data + kHeaderSize, data + kHeaderSize + tick_count);
+    } else {
+        std::cerr << "Error: '" << path << "' is not a valid input recording.\n";
+    }
+
+    std::free(data);
+    return ok;
+}
@@ -0,0 +1,62 @@
+#ifndef INPUT_RECORDING_H
+#define INPUT_RECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "player_input.h"
+
+// Per-tick log of player input plus the RNG seed, enemy count and map needed to replay a session
+// deterministically.
+//
+// File layout (little-endian):
+//   magic[4] = "PGIR"
+//   version u16 (2)
+//   flags u16 (reserved, 0)
+//   seed u32
+//   map_hash u32 (GameMap::ContentHash() before the first tick)
+//   tick_count u32
+//   final_state_hash u32 (Game::StateHash() after the last tick, 0 if unknown)
+//   enemy_count u32 (enemies spawned at the start)
+//   map_index u32 (maps.db record the map was loaded from; ignored for text maps)
+//   ticks[tick_count] u8: bits 0..2 direction, bit 3 fire, bit 4 pause
+class InputRecording {
+   public:
+    InputRecording() = default;
+
+    InputRecording(std::uint32_t seed, std::uint32_t map_hash, int enemy_count, int map_index);
+
+    void Append(const PlayerInput& input);
+
+    std::size_t TickCount() const { return _ticks.size(); }
+
+    // Returns the input recorded for `tick`, or a neutral input past the end of the log.
+    PlayerInput At(std::size_t tick) const;
+
+    std::uint32_t Seed() const { return _seed; }
+
+    std::uint32_t MapHash() const { return _map_hash; }
+
+    int EnemyCount() const { return _enemy_count; }
+
+    int MapIndex() const { return _map_index; }
+
+    std::uint32_t FinalStateHash() const { return _final_state_hash; }
+
+    void SetFinalStateHash(std::uint32_t hash) { _final_state_hash = hash; }
+
+    bool Save(const std::string& path) const;
+
+    bool Load(const std::string& path);
+
+   private:
+    std::uint32_t _seed{0};
+    std::uint32_t _map_hash{0};
+    std::uint32_t _final_state_hash{0};
+    int _enemy_count{0};
+    int _map_index{0};
+    std::vector<std::uint8_t> _ticks;
+};
+
+#endif  // INPUT_RECORDING_H
@@ -1,83 +1,66 @@
 // Copied From CppND-Capstone-Snake-Game
 #include <iostream>
 #include <memory>
-#include "../shared/config/config_manager.h"
 #include "../shared/error_handler/error_handler.h"
 #include "AICentral.h"
-#include "constants.h"
 #include "controller.h"
 #include "game.h"
+#include "game_settings.h"
 #include "gamemap.h"
-#include "path_resolver.h"
+#include "input_recording.h"
 #include "renderer.h"
 
-int main() {
-    // Initialize configuration system
-    ConfigManager config;
-    if (!config_manager_init(&config, "Character Game")) {
-        ErrorHandler_Log();
-        return 1;
+int main(int argc, char** argv) {
+    std::string record_path;
+    std::string replay_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else {
+            std::cout << "Usage: PlayGame [--record PATH | --replay PATH]\n";
+            return arg == "--help" ? 0 : 1;
+        }
     }
 
-    // Register configuration entries with defaults
-    config_register_entry(&config, "display", "grid_size", CONFIG_TYPE_INT,
-                          config_make_int(GRID_SIZE), true);
-    config_register_entry(&config, "display", "grid_width", CONFIG_TYPE_INT,
-                          config_make_int(GRID_WIDTH), true);
-    config_register_entry(&config, "display", "grid_height", CONFIG_TYPE_INT,
-                          config_make_int(GRID_HEIGHT), true);
-    config_register_entry(&config, "performance", "target_fps", CONFIG_TYPE_INT,
-                          config_make_int(TARGET_FPS), true);
-    config_register_entry(&config, "performance", "ms_per_frame", CONFIG_TYPE_INT,
-                          config_make_int(MS_PER_FRAME), true);
-    config_register_entry(&config, "files", "map_file", CONFIG_TYPE_STRING,
-                          config_make_string("game.map"), false);
-
-    // Load configuration file
-    const std::string config_path = resolve_game_config_path();
-    if (!config_manager_load(&config, config_path.c_str())) {
-        std::cerr << "Warning: Failed to load configuration file, using defaults\n";
-        ErrorHandler_Log();
-        ErrorHandler_Clear();  // Clear error to allow execution with defaults
+    GameSettings settings;
+    if (!load_game_settings(&settings)) {
+        return 1;
     }
 
-    // Get configuration values
-    const auto positive_or_default = [](int value, int fallback, const char* label) {
-        if (value > 0) {
-            return value;
+    InputRecording replay;
+    if (!replay_path.empty()) {
+        if (!replay.Load(replay_path)) {
+            return 1;
         }
+        settings.seed = replay.Seed();
+        settings.enemy_count = replay.EnemyCount();
+        settings.map_index = replay.MapIndex();
+    }
 
-        std::cerr << "Warning: Invalid config value for " << label << " (" << value
-                  << "), using default " << fallback << ".\n";
-        return fallback;
-    };
-
-    const int kGridSize =
-        positive_or_default(config_get_int(&config, "display", "grid_size", GRID_SIZE), GRID_SIZE,
-                            "display.grid_size");
-    const int kGridWidth = positive_or_default(
-        config_get_int(&config, "display", "grid_width", GRID_WIDTH), GRID_WIDTH,
-        "display.grid_width");
-    const int kGridHeight = positive_or_default(
-        config_get_int(&config, "display", "grid_height", GRID_HEIGHT), GRID_HEIGHT,
-        "display.grid_height");
-    const int kFramesPerSecond = positive_or_default(
-        config_get_int(&config, "performance", "target_fps", TARGET_FPS), TARGET_FPS,
-        "performance.target_fps");
-    const int kMsPerFrame = positive_or_default(
-        config_get_int(&config, "performance", "ms_per_frame", MS_PER_FRAME), MS_PER_FRAME,
-        "performance.ms_per_frame");
-    const char* configured_map_file = config_get_string(&config, "files", "map_file", "game.map");
-    const std::string map_path = resolve_game_map_path(configured_map_file);
+    const int kGridSize = settings.grid_size;
+    const int kGridWidth = settings.grid_width;
+    const int kGridHeight = settings.grid_height;
+    const int kFramesPerSecond = settings.target_fps;
+    const int kMsPerFrame = settings.ms_per_frame;
+    const int kTickRate = settings.tick_rate;
+    const std::string& config_path = settings.config_path;
+    const std::string& map_path = settings.map_path;
 
     std::cout << "Starting Character Game with configuration:\n";
     std::cout << "  Config path: " << config_path << "\n";
     std::cout << "  Grid: " << kGridWidth << "x" << kGridHeight << " (size: " << kGridSize << ")\n";
     std::cout << "  Target FPS: " << kFramesPerSecond << "\n";
+    std::cout << "  Tick rate: " << kTickRate << "\n";
+    std::cout << "  Seed: " << settings.seed << "\n";
+    std::cout << "  Enemies: " << settings.enemy_count << "\n";
+    std::cout << "  Worker threads: " << settings.worker_threads << "\n";
     std::cout << "  Map path: " << map_path << "\n";
 
-    std::shared_ptr<GameMap> map_ptr =
-        std::make_shared<GameMap>(kGridHeight, kGridWidth, kGridSize, map_path);
+    std::shared_ptr<GameMap> map_ptr = std::make_shared<GameMap>(
+        kGridHeight, kGridWidth, kGridSize, map_path, settings.map_index);
     if (!map_ptr->MatchesDimensions(kGridHeight, kGridWidth)) {
         std::cerr << "Error: Map dimensions do not match configured grid dimensions.\n";
         std::cerr << "  Expected rows x cols: " << kGridHeight << "x" << kGridWidth << "\n";
@@ -87,6 +70,10 @@ int main() {
                      "display.grid_height.\n";
         return 1;
     }
+    if (!replay_path.empty() && replay.MapHash() != map_ptr->ContentHash()) {
+        std::cerr << "Error: Replay '" << replay_path << "' was recorded on a different map.\n";
+        return 1;
+    }
     std::shared_ptr<AICentral> aiCentral =
         std::make_shared<AICentral>(map_ptr->RowCount(), map_ptr->ColCount());
 
@@ -98,14 +85,31 @@ int main() {
         return 1;
     }
 
-    Renderer renderer(kGridSize, kGridWidth, kGridHeight, map_ptr, &context, config_path);
-    Controller controller;
-    Game game(kGridSize, kGridWidth, kGridHeight, map_ptr, aiCentral);
-    game.Run(controller, renderer, kMsPerFrame);
+    int score = 0;
+    {
+        // Renderer owns GPU resources, so it must be destroyed before the SDL context.
+        Renderer renderer(kGridSize, kGridWidth, kGridHeight, map_ptr, &context, config_path);
+        Controller controller;
+        Game game(kGridSize, kGridWidth, kGridHeight, map_ptr, aiCentral, settings.seed,
+                  settings.enemy_count, settings.worker_threads);
+        if (!record_path.empty()) {
+            game.StartRecording(settings.map_index);
+        }
+        game.Run(controller, renderer, kMsPerFrame, kTickRate,
+                 replay_path.empty() ? nullptr : &replay);
+        score = game.GetScore();
+        if (!record_path.empty()) {
+            const InputRecording& recording = game.FinishRecording();
+            if (recording.Save(record_path)) {
+                std::cout << "Recorded " << recording.TickCount() << " ticks to " << record_path
+                          << "\n";
+            }
+        }
+    }
 
     // Cleanup
     sdl_cleanup_context(&context);
     std::cout << "Game has terminated successfully!\n";
-    std::cout << "Score: " << game.GetScore() << "\n";
+    std::cout << "Score: " << score << "\n";
     return 0;
 }
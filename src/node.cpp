@@ -1,3 +0,0 @@
-#include "node.h"
-
-Node::Node(int x, int y) : x(x), y(y) {}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "path_finder.h"
+#include <algorithm>
+#include <cstdlib>
+
+PathFinder::PathFinder(int rows, int cols) : _rows(std::max(rows, 0)), _cols(std::max(cols, 0)) {
+    const std::size_t cells = static_cast<std::size_t>(_rows) * static_cast<std::size_t>(_cols);
+    _seen_generation.assign(cells, 0);
+    _closed_generation.assign(cells, 0);
+    _cost.assign(cells, 0);
+    _estimate.assign(cells, 0);
+    _parent.assign(cells, kNoParent);
+    _heap_position.assign(cells, 0);
+    _heap.reserve(cells);
+    _path.reserve(cells);
+}
+
+int PathFinder::Heuristic(int index, int goal_row, int goal_col) const {
+    return std::abs(index / _cols - goal_row) + std::abs(index % _cols - goal_col);
+}
+
+bool PathFinder::FindPath(const GameMap& map, GameMap::CellCoord start, GameMap::CellCoord goal) {
+    _path.clear();
+    _heap.clear();
+    _expanded = 0;
+    if (start.row < 0 || start.col < 0 || start.row >= _rows || start.col >= _cols ||
+        goal.row < 0 || goal.col < 0 || goal.row >= _rows || goal.col >= _cols) {
+        return false;
+    }
+    if (!map.AreaIsAvailable(start.row, start.col) || !map.AreaIsAvailable(goal.row, goal.col)) {
+        return false;
+    }
+
+    if (++_generation == 0) {
+        // Wrapped after 2^32 queries: stale stamps could now look current, so reset them once.
+        std::fill(_seen_generation.begin(), _seen_generation.end(), 0);
+        std::fill(_closed_generation.begin(), _closed_generation.end(), 0);
+        _generation = 1;
+    }
+
+    const std::uint32_t start_index = static_cast<std::uint32_t>(start.row * _cols + start.col);
+    const std::uint32_t goal_index = static_cast<std::uint32_t>(goal.row * _cols + goal.col);
+    _seen_generation[start_index] = _generation;
+    _cost[start_index] = 0;
+    _estimate[start_index] = static_cast<std::uint32_t>(Heuristic(start_index, goal.row, goal.col));
+    _parent[start_index] = kNoParent;
+    HeapPush(start_index);
+
+    while (!_heap.empty()) {
+        const std::uint32_t current = HeapPop();
+        _closed_generation[current] = _generation;
+        ++_expanded;
+        if (current == goal_index) {
+            BuildPath(goal_index);
+            return true;
+        }
+
+        const int row = static_cast<int>(current) / _cols;
+        const int col = static_cast<int>(current) % _cols;
+        const std::uint32_t next_cost = _cost[current] + 1;
+        const auto relax = [&](int next_row, int next_col) {
+            if (next_row < 0 || next_col < 0 || next_row >= _rows || next_col >= _cols) {
+                return;
+            }
+            const std::uint32_t next = static_cast<std::uint32_t>(next_row * _cols + next_col);
+            if (_closed_generation[next] == _generation) {
+                return;
+            }
+            if (_seen_generation[next] != _generation) {
+                if (!map.AreaIsAvailable(next_row, next_col)) {
+                    // Stamp blocked cells closed so they are only tested once per query.
+                    _closed_generation[next] = _generation;
+                    return;
+                }
+                _seen_generation[next] = _generation;
+                _cost[next] = next_cost;
+                _estimate[next] = next_cost +
+                                  static_cast<std::uint32_t>(Heuristic(next, goal.row, goal.col));
+                _parent[next] = current;
+                HeapPush(next);
+            } else if (next_cost < _cost[next]) {
+                _estimate[next] -= _cost[next] - next_cost;
+                _cost[next] = next_cost;
+                _parent[next] = current;
+                HeapSiftUp(_heap_position[next]);
+            }
+        };
+        relax(row, col - 1);
+        relax(row, col + 1);
+        relax(row - 1, col);
+        relax(row + 1, col);
+    }
+
+    return false;
+}
+
+bool PathFinder::HeapLess(std::uint32_t lhs, std::uint32_t rhs) const {
+    if (_estimate[lhs] != _estimate[rhs]) {
+        return _estimate[lhs] < _estimate[rhs];
+    }
+    // Prefer the node further from the start: it is closer to the goal for the same estimate.
+    return _cost[lhs] > _cost[rhs];
+}
+
+void PathFinder::HeapPush(std::uint32_t index) {
+    _heap.push_back(index);
+    _heap_position[index] = static_cast<std::uint32_t>(_heap.size() - 1);
+    HeapSiftUp(_heap.size() - 1);
+}
+
+std::uint32_t PathFinder::HeapPop() {
+    const std::uint32_t top = _heap.front();
+    _heap.front() = _heap.back();
+    _heap_position[_heap.front()] = 0;
+    _heap.pop_back();
+    if (!_heap.empty()) {
+        HeapSiftDown(0);
+    }
+    return top;
+}
+
+void PathFinder::HeapSiftUp(std::size_t position) {
+    const std::uint32_t index = _heap[position];
+    while (position > 0) {
+        const std::size_t parent = (position - 1) / 2;
+        if (!HeapLess(index, _heap[parent])) {
+            break;
+        }
+        _heap[position] = _heap[parent];
+        _heap_position[_heap[position]] = static_cast<std::uint32_t>(position);
+        position = parent;
+    }
+    _heap[position] = index;
+    _heap_position[index] = static_cast<std::uint32_t>(position);
+}
+
+void PathFinder::HeapSiftDown(std::size_t position) {
+    const std::uint32_t index = _heap[position];
+    const std::size_t size = _heap.size();
+    while (true) {
+        std::size_t child = position * 2 + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && HeapLess(_heap[child + 1], _heap[child])) {
+            ++child;
+        }
+        if (!HeapLess(_heap[child], index)) {
+            break;
+        }
+        _heap[position] = _heap[child];
+        _heap_position[_heap[position]] = static_cast<std::uint32_t>(position);
+        position = child;
+    }
+    _heap[position] = index;
+    _heap_position[index] = static_cast<std::uint32_t>(position);
+}
+
+void PathFinder::BuildPath(std::uint32_t goal_index) {
+    // Walk parents back to the start, then reverse in place; _path was reserved for every cell.
+    for (std::uint32_t index = goal_index; _parent[index] != kNoParent; index = _parent[index]) {
+        _path.push_back(GameMap::CellCoord{static_cast<int>(index) / _cols,
+                                           static_cast<int>(index) % _cols});
+    }
+    std::reverse(_path.begin(), _path.end());
+}
@@ -0,0 +1,63 @@
+#ifndef PATH_FINDER_H
+#define PATH_FINDER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "gamemap.h"
+
+// A* over GameMap cell walkability, 4-connected with unit step cost. All search state lives in
+// arrays indexed by cell that are sized once; a generation counter marks which entries belong
+// to the current query, so nothing is cleared or allocated per FindPath() call.
+//
+// Not thread-safe: give each thread that searches its own PathFinder.
+class PathFinder {
+   public:
+    PathFinder(int rows, int cols);
+
+    // Searches from `start` to `goal` on `map`. On success Path() holds the cells after `start`
+    // up to and including `goal` (empty when start == goal). Returns false if either end is
+    // blocked or out of bounds, or if the goal cannot be reached.
+    bool FindPath(const GameMap& map, GameMap::CellCoord start, GameMap::CellCoord goal);
+
+    const std::vector<GameMap::CellCoord>& Path() const { return _path; }
+
+    // Nodes taken off the open list by the latest query, for profiling.
+    std::size_t LastExpandedCount() const { return _expanded; }
+
+   private:
+    static constexpr std::uint32_t kNoParent = 0xFFFFFFFF;
+
+    int Heuristic(int index, int goal_row, int goal_col) const;
+
+    bool HeapLess(std::uint32_t lhs, std::uint32_t rhs) const;
+
+    void HeapPush(std::uint32_t index);
+
+    std::uint32_t HeapPop();
+
+    void HeapSiftUp(std::size_t position);
+
+    void HeapSiftDown(std::size_t position);
+
+    void BuildPath(std::uint32_t goal_index);
+
+    int _rows;
+    int _cols;
+    std::uint32_t _generation{0};
+    std::size_t _expanded{0};
+
+    // Per-cell search state, valid only where _seen_generation matches _generation.
+    std::vector<std::uint32_t> _seen_generation;
+    std::vector<std::uint32_t> _closed_generation;
+    std::vector<std::uint32_t> _cost;
+    std::vector<std::uint32_t> _estimate;
+    std::vector<std::uint32_t> _parent;
+    std::vector<std::uint32_t> _heap_position;
+
+    // Binary min-heap of cell indices ordered by estimate, then by larger cost.
+    std::vector<std::uint32_t> _heap;
+    std::vector<GameMap::CellCoord> _path;
+};
+
+#endif  // PATH_FINDER_H
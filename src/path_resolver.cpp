@@ -3,7 +3,9 @@
 #include <cstdio>
 #include <filesystem>
 #include <vector>
+#ifndef PLAYGAME_HEADLESS
 #include "SDL3/SDL.h"
+#endif
 
 namespace {
 bool file_exists(const std::filesystem::path& path) {
@@ -16,6 +18,7 @@ bool file_exists(const std::filesystem::path& path) {
 }
 
 std::filesystem::path get_executable_base_dir() {
+#ifndef PLAYGAME_HEADLESS
     const char* raw_base_path = SDL_GetBasePath();
     if (raw_base_path && raw_base_path[0] != '\0') {
         std::filesystem::path base(raw_base_path);
@@ -26,6 +29,7 @@ std::filesystem::path get_executable_base_dir() {
     if (raw_base_path) {
         SDL_free((void*)raw_base_path);
     }
+#endif
 
     return std::filesystem::current_path();
 }
@@ -13,8 +13,6 @@ class Player : public Character {
     void Move() override;
 
     int GetGridSize();
-
-    bool DamageFrontSubtile();
 };
 
 #endif
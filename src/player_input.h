@@ -0,0 +1,14 @@
+#ifndef PLAYER_INPUT_H
+#define PLAYER_INPUT_H
+
+#include "character.h"
+
+// Player commands for one simulation tick. Produced by Controller from SDL input, or by a
+// script when the simulation runs headless.
+struct PlayerInput {
+    Character::Direction direction{Character::Direction::kNone};
+    bool fire{false};
+    bool pause{false};
+};
+
+#endif  // PLAYER_INPUT_H
@@ -0,0 +1,105 @@
+#include "projectile_pool.h"
+#include <algorithm>
+#include <cstdlib>
+
+ProjectilePool::ProjectilePool(int grid_size, std::size_t capacity,
+                               std::shared_ptr<GameMap> map_ptr)
+    : _map_ptr(map_ptr),
+      _step(std::max(1, grid_size / GameMap::kSubtilesPerAxis)),
+      _pos_x(capacity, 0),
+      _pos_y(capacity, 0),
+      _prev_x(capacity, 0),
+      _prev_y(capacity, 0),
+      _velocity_x(capacity, 0),
+      _velocity_y(capacity, 0),
+      _active(capacity, 0) {
+    _free.reserve(capacity);
+    for (std::size_t id = capacity; id > 0; --id) {
+        _free.push_back(static_cast<std::uint32_t>(id - 1));
+    }
+}
+
+bool ProjectilePool::Spawn(int x, int y, Character::Direction direction, int speed) {
+    if (_free.empty() || speed <= 0) {
+        return false;
+    }
+
+    int velocity_x = 0;
+    int velocity_y = 0;
+    switch (direction) {
+        case Character::Direction::kUp:
+            velocity_y = -speed;
+            break;
+        case Character::Direction::kDown:
+            velocity_y = speed;
+            break;
+        case Character::Direction::kLeft:
+            velocity_x = -speed;
+            break;
+        case Character::Direction::kRight:
+            velocity_x = speed;
+            break;
+        case Character::Direction::kNone:
+            return false;
+    }
+
+    const std::uint32_t id = _free.back();
+    _free.pop_back();
+    _pos_x[id] = x;
+    _pos_y[id] = y;
+    _prev_x[id] = x;
+    _prev_y[id] = y;
+    _velocity_x[id] = velocity_x;
+    _velocity_y[id] = velocity_y;
+    _active[id] = 1;
+    return true;
+}
+
+void ProjectilePool::Update() {
+    for (std::size_t id = 0; id < _active.size(); ++id) {
+        if (!_active[id]) {
+            continue;
+        }
+        _prev_x[id] = _pos_x[id];
+        _prev_y[id] = _pos_y[id];
+        if (!Advance(id)) {
+            Release(id);
+        }
+    }
+}
+
+bool ProjectilePool::Advance(std::size_t id) {
+    // Projectiles fly along one axis, so steps no longer than a subtile visit every subtile
+    // on the way.
+    int remaining = std::abs(_velocity_x[id]) + std::abs(_velocity_y[id]);
+    const int sign_x = (_velocity_x[id] > 0) - (_velocity_x[id] < 0);
+    const int sign_y = (_velocity_y[id] > 0) - (_velocity_y[id] < 0);
+    while (remaining > 0) {
+        const int step = std::min(_step, remaining);
+        remaining -= step;
+        _pos_x[id] += sign_x * step;
+        _pos_y[id] += sign_y * step;
+
+        int row = 0;
+        int col = 0;
+        int subtile_index = 0;
+        if (!_map_ptr->WorldToSubtile(_pos_x[id], _pos_y[id], &row, &col, &subtile_index) ||
+            !_map_ptr->IsInBounds(row, col)) {
+            return false;
+        }
+        if (!_map_ptr->IsSubtileWalkable(row, col, subtile_index)) {
+            _map_ptr->DamageSubtile(row, col, subtile_index);
+            ++_hits;
+            return false;
+        }
+    }
+    return true;
+}
+
+void ProjectilePool::Release(std::size_t id) {
+    if (!_active[id]) {
+        return;
+    }
+    _active[id] = 0;
+    _free.push_back(static_cast<std::uint32_t>(id));
+}
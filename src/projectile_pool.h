@@ -0,0 +1,65 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "character.h"
+#include "gamemap.h"
+
+// Fixed-capacity pool of projectiles stored as parallel arrays indexed by slot. Every array is
+// sized in the constructor and slots are recycled through a free list, so firing never
+// allocates. Positions are the projectile's centre in world pixels.
+class ProjectilePool {
+   public:
+    ProjectilePool(int grid_size, std::size_t capacity, std::shared_ptr<GameMap> map_ptr);
+
+    // Launches a projectile from (x, y). Returns false, dropping the shot, when every slot is
+    // already in flight.
+    bool Spawn(int x, int y, Character::Direction direction, int speed);
+
+    // Moves every projectile by one tick. Movement is swept one subtile at a time, so fast
+    // projectiles cannot tunnel; the first non-walkable subtile entered is damaged through
+    // GameMap::DamageSubtile and the projectile is released. Leaving the map also releases it.
+    void Update();
+
+    std::size_t Capacity() const { return _active.size(); }
+
+    std::size_t ActiveCount() const { return _active.size() - _free.size(); }
+
+    // Subtiles hit since construction.
+    std::uint64_t HitCount() const { return _hits; }
+
+    bool IsActive(std::size_t id) const { return _active[id] != 0; }
+
+    int GetX(std::size_t id) const { return _pos_x[id]; }
+
+    int GetY(std::size_t id) const { return _pos_y[id]; }
+
+    int GetPrevX(std::size_t id) const { return _prev_x[id]; }
+
+    int GetPrevY(std::size_t id) const { return _prev_y[id]; }
+
+    void Release(std::size_t id);
+
+   private:
+    // Returns false once the projectile has hit something or left the map.
+    bool Advance(std::size_t id);
+
+    std::shared_ptr<GameMap> _map_ptr;
+    int _step;
+    std::uint64_t _hits{0};
+
+    std::vector<int> _pos_x;
+    std::vector<int> _pos_y;
+    std::vector<int> _prev_x;
+    std::vector<int> _prev_y;
+    std::vector<int> _velocity_x;
+    std::vector<int> _velocity_y;
+    std::vector<std::uint8_t> _active;
+    // Free slots, taken from the back; starts with the lowest id on top.
+    std::vector<std::uint32_t> _free;
+};
+
+#endif  // PROJECTILE_POOL_H
@@ -1,17 +1,24 @@
 #include "renderer.h"
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 #include "../shared/config/config_manager.h"
 #include "../shared/error_handler/error_handler.h"
 #include "constants.h"
-#include "enemy.h"
+#include "enemy_store.h"
 #include "player.h"
+#include "projectile_pool.h"
 
 namespace {
 constexpr int kSubtilesPerAxis = GameMap::kSubtilesPerAxis;
+constexpr std::size_t kObjectsPerCharacter = 4;
+constexpr std::size_t kCharacterCount = 1 + ENEMY_COUNT;
 constexpr float kSubtileScale = 1.0f / static_cast<float>(kSubtilesPerAxis);
 
 ConfigColorRGBA color_with_tile_variation(const ConfigColorRGBA& base, std::uint8_t tile_id) {
@@ -22,6 +29,50 @@ ConfigColorRGBA color_with_tile_variation(const ConfigColorRGBA& base, std::uint
     out.b = static_cast<std::uint8_t>(std::min(255, static_cast<int>(out.b) + variation));
     return out;
 }
+
+float interpolate(int previous, int current, float alpha) {
+    const float t = std::clamp(alpha, 0.0f, 1.0f);
+    return static_cast<float>(previous) + static_cast<float>(current - previous) * t;
+}
+
+std::uint32_t pack_color_key(const ConfigColorRGBA& color) {
+    // Same ordering as comparing r, g, b, a lexicographically.
+    return (static_cast<std::uint32_t>(color.r) << 24) | (static_cast<std::uint32_t>(color.g) << 16) |
+           (static_cast<std::uint32_t>(color.b) << 8) | static_cast<std::uint32_t>(color.a);
+}
+
+// Stable LSD radix sort on the packed color key, one byte per pass. Passes where every
+// object shares the same byte are skipped, which is the common case for a small palette.
+void radix_sort_by_color(std::vector<RenderObject>& objects, std::vector<RenderObject>& scratch) {
+    const std::size_t count = objects.size();
+    if (count < 2) {
+        return;
+    }
+
+    scratch.resize(count);
+    RenderObject* src = objects.data();
+    RenderObject* dst = scratch.data();
+    for (int shift = 0; shift < 32; shift += 8) {
+        std::array<std::size_t, 257> offsets{};
+        for (std::size_t i = 0; i < count; ++i) {
+            ++offsets[((pack_color_key(src[i].color) >> shift) & 0xFFu) + 1];
+        }
+        if (std::find(offsets.begin(), offsets.end(), count) != offsets.end()) {
+            continue;
+        }
+        for (std::size_t digit = 1; digit < offsets.size(); ++digit) {
+            offsets[digit] += offsets[digit - 1];
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[offsets[(pack_color_key(src[i].color) >> shift) & 0xFFu]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != objects.data()) {
+        std::copy(src, src + count, objects.data());
+    }
+}
 }  // namespace
 
 Renderer::Renderer(const int grid_size, const int grid_width, const int grid_height,
@@ -50,6 +101,8 @@ Renderer::Renderer(const int grid_size, const int grid_width, const int grid_hei
                           config_make_rgba(170, 170, 0, 255), false);
     config_register_entry(&_config, "colors", "enemy_eye_color", CONFIG_TYPE_COLOR_RGBA,
                           config_make_rgba(0, 0, 255, 255), false);
+    config_register_entry(&_config, "colors", "projectile_color", CONFIG_TYPE_COLOR_RGBA,
+                          config_make_rgba(255, 255, 255, 255), false);
 
     // Register character rendering configuration entries
     config_register_entry(&_config, "character", "eye_offset_x", CONFIG_TYPE_INT,
@@ -80,84 +133,200 @@ Renderer::Renderer(const int grid_size, const int grid_width, const int grid_hei
     }
 
     RefreshRenderConfig();
+
+    const std::size_t map_capacity = static_cast<std::size_t>(_map_ptr->RowCount()) *
+                                     static_cast<std::size_t>(_map_ptr->ColCount()) *
+                                     GameMap::kSubtilesPerCell;
+    const std::size_t character_capacity = kObjectsPerCharacter * kCharacterCount;
+    // The frame list also carries the map when the static layer is unavailable.
+    _render_objects.reserve(map_capacity + character_capacity);
+    _map_objects.reserve(map_capacity);
+    _batch_rects.reserve(map_capacity + character_capacity);
+    _sort_scratch.reserve(map_capacity + character_capacity);
+    _changed_cells.reserve(GameMap::kChangeLogCapacity);
 }
 
-Renderer::~Renderer() {}
+Renderer::~Renderer() {
+    if (_static_layer) {
+        SDL_DestroyTexture(_static_layer);
+    }
+}
 
-void Renderer::Render(Player& player, const Enemy& enemy) {
-    std::vector<RenderObject> render_objects;
-    const float subtile_size = static_cast<float>(_grid_size) * kSubtileScale;
+void Renderer::Render(const Player& player, const EnemyStore& enemies,
+                      const ProjectilePool& projectiles, float alpha) {
+    SDL_Renderer* sdl_renderer = sdl_get_renderer(_context);
+    // Growing the enemy population is not steady state: size the frame arena for it up front.
+    const std::size_t frame_capacity = _map_objects.capacity() +
+                                       kObjectsPerCharacter * (1 + enemies.Capacity()) +
+                                       projectiles.Capacity();
+    _render_objects.reserve(frame_capacity);
+    _batch_rects.reserve(frame_capacity);
+    _sort_scratch.reserve(frame_capacity);
+    const std::size_t capacity_before = RenderBufferCapacity();
+    _render_objects.clear();
+    _draw_calls = 0;
+
+    if (UpdateStaticLayer()) {
+        SDL_RenderTexture(sdl_renderer, _static_layer, nullptr, nullptr);
+        ++_draw_calls;
+    } else {
+        AddMapObjects(_render_objects);
+    }
+
+    // Add player and enemies to render list
+    AddCharacterObjects(_render_objects, ObjectType::kPlayer, player.GetDirection(),
+                        interpolate(player.GetPrevX(), player.GetX(), alpha),
+                        interpolate(player.GetPrevY(), player.GetY(), alpha));
+    for (std::size_t id = 0; id < enemies.Size(); ++id) {
+        if (!enemies.IsAlive(id)) {
+            continue;
+        }
+        AddCharacterObjects(_render_objects, ObjectType::kEnemy, enemies.GetDirection(id),
+                            interpolate(enemies.GetPrevX(id), enemies.GetX(id), alpha),
+                            interpolate(enemies.GetPrevY(id), enemies.GetY(id), alpha));
+    }
+
+    // Projectiles are one subtile-sized square centred on their position.
+    const float projectile_size = static_cast<float>(_grid_size) * kSubtileScale;
+    for (std::size_t id = 0; id < projectiles.Capacity(); ++id) {
+        if (!projectiles.IsActive(id)) {
+            continue;
+        }
+        const float x = interpolate(projectiles.GetPrevX(id), projectiles.GetX(id), alpha);
+        const float y = interpolate(projectiles.GetPrevY(id), projectiles.GetY(id), alpha);
+        _render_objects.push_back({SDL_FRect{x - projectile_size / 2, y - projectile_size / 2,
+                                             projectile_size, projectile_size},
+                                   _projectile_color});
+    }
+
+    DrawObjects(_render_objects);
+
+    SDL_RenderPresent(sdl_renderer);
 
-    // Add map objects to render list
+    if (_frames_rendered > 0 && RenderBufferCapacity() != capacity_before) {
+        ++_steady_state_buffer_growths;
+    }
+    ++_frames_rendered;
+    assert(_steady_state_buffer_growths == 0 && "render buffers grew after the first frame");
+}
+
+std::size_t Renderer::RenderBufferCapacity() const {
+    return _render_objects.capacity() + _map_objects.capacity() + _batch_rects.capacity() +
+           _sort_scratch.capacity() + _changed_cells.capacity();
+}
+
+bool Renderer::UpdateStaticLayer() {
+    if (_static_layer_unavailable) {
+        return false;
+    }
+
+    SDL_Renderer* sdl_renderer = sdl_get_renderer(_context);
+    if (!_static_layer) {
+        _static_layer = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_RGBA8888,
+                                          SDL_TEXTUREACCESS_TARGET, _screen_width, _screen_height);
+        if (!_static_layer) {
+            std::cerr << "Warning: Renderer could not create static map layer ("
+                      << SDL_GetError() << "), drawing map every frame.\n";
+            _static_layer_unavailable = true;
+            return false;
+        }
+        _static_layer_valid = false;
+    }
+
+    _map_objects.clear();
+    _changed_cells.clear();
+    const std::size_t cell_count = static_cast<std::size_t>(_map_ptr->RowCount()) *
+                                   static_cast<std::size_t>(_map_ptr->ColCount());
+    // Changed cells may repeat; past one entry per cell a full rebuild is no more work.
+    if (!_static_layer_valid ||
+        !_map_ptr->CollectChangedCells(_static_layer_revision, &_changed_cells) ||
+        _changed_cells.size() >= cell_count) {
+        AddMapObjects(_map_objects);
+    } else {
+        for (const auto& cell : _changed_cells) {
+            AddCellObjects(_map_objects, cell.row, cell.col);
+        }
+    }
+    _static_layer_revision = _map_ptr->Revision();
+    _static_layer_valid = true;
+
+    if (!_map_objects.empty()) {
+        SDL_SetRenderTarget(sdl_renderer, _static_layer);
+        DrawObjects(_map_objects);
+        SDL_SetRenderTarget(sdl_renderer, nullptr);
+    }
+    return true;
+}
+
+void Renderer::AddMapObjects(std::vector<RenderObject>& objects) const {
     for (int row = 0; row < _map_ptr->RowCount(); ++row) {
         for (int col = 0; col < _map_ptr->ColCount(); ++col) {
-            const float base_x = static_cast<float>(col * _grid_size);
-            const float base_y = static_cast<float>(row * _grid_size);
-
-            if (_map_ptr->HasDestructibleSubtiles(row, col)) {
-                for (int subtile_row = 0; subtile_row < kSubtilesPerAxis; ++subtile_row) {
-                    for (int subtile_col = 0; subtile_col < kSubtilesPerAxis; ++subtile_col) {
-                        const int subtile_index = subtile_row * kSubtilesPerAxis + subtile_col;
-                        const bool destroyed =
-                            _map_ptr->IsSubtileDestroyed(row, col, subtile_index);
-                        const std::uint8_t movement =
-                            _map_ptr->GetSubtileMovement(row, col, subtile_index);
-                        SDL_FRect subtile_rect{
-                            base_x + static_cast<float>(subtile_col) * subtile_size,
-                            base_y + static_cast<float>(subtile_row) * subtile_size, subtile_size,
-                            subtile_size};
-
-                        if (destroyed || movement == GameMap::kMovementPass) {
-                            render_objects.push_back({subtile_rect, _floor_color});
-                        } else {
-                            const auto tile_id = _map_ptr->GetSubtileId(row, col, subtile_index);
-                            render_objects.push_back(
-                                {subtile_rect, color_with_tile_variation(_wall_color, tile_id)});
-                        }
-                    }
-                }
-                continue;
-            }
+            AddCellObjects(objects, row, col);
+        }
+    }
+}
+
+void Renderer::AddCellObjects(std::vector<RenderObject>& objects, int row, int col) const {
+    const float subtile_size = static_cast<float>(_grid_size) * kSubtileScale;
+    const float base_x = static_cast<float>(col * _grid_size);
+    const float base_y = static_cast<float>(row * _grid_size);
 
-            SDL_FRect block;
-            block.w = static_cast<float>(_grid_size);
-            block.h = static_cast<float>(_grid_size);
-            block.x = base_x;
-            block.y = base_y;
+    if (_map_ptr->HasDestructibleSubtiles(row, col)) {
+        for (int subtile_row = 0; subtile_row < kSubtilesPerAxis; ++subtile_row) {
+            for (int subtile_col = 0; subtile_col < kSubtilesPerAxis; ++subtile_col) {
+                const int subtile_index = subtile_row * kSubtilesPerAxis + subtile_col;
+                const bool destroyed = _map_ptr->IsSubtileDestroyed(row, col, subtile_index);
+                const std::uint8_t movement = _map_ptr->GetSubtileMovement(row, col, subtile_index);
+                SDL_FRect subtile_rect{base_x + static_cast<float>(subtile_col) * subtile_size,
+                                       base_y + static_cast<float>(subtile_row) * subtile_size,
+                                       subtile_size, subtile_size};
 
-            if (_map_ptr->GetElement(row, col) == 1) {
-                render_objects.push_back({block, _wall_color});
-            } else {
-                render_objects.push_back({block, _floor_color});
+                if (destroyed || movement == GameMap::kMovementPass) {
+                    objects.push_back({subtile_rect, _floor_color});
+                } else {
+                    const auto tile_id = _map_ptr->GetSubtileId(row, col, subtile_index);
+                    objects.push_back({subtile_rect, color_with_tile_variation(_wall_color, tile_id)});
+                }
             }
         }
+        return;
     }
 
-    // Add player and enemy to render list
-    if (player.IsMoving()) {
-        player.Move();
+    SDL_FRect block;
+    block.w = static_cast<float>(_grid_size);
+    block.h = static_cast<float>(_grid_size);
+    block.x = base_x;
+    block.y = base_y;
+
+    if (_map_ptr->GetElement(row, col) == 1) {
+        objects.push_back({block, _wall_color});
+    } else {
+        objects.push_back({block, _floor_color});
     }
-    AddCharacterObjects(render_objects, ObjectType::kPlayer, player.GetDirection(), player.GetX(),
-                        player.GetY());
-    AddCharacterObjects(render_objects, ObjectType::kEnemy, enemy.GetDirection(), enemy.GetX(),
-                        enemy.GetY());
+}
 
-    // Sort objects by color
-    std::sort(render_objects.begin(), render_objects.end(),
-              [](const RenderObject& a, const RenderObject& b) { return a.color < b.color; });
+void Renderer::DrawObjects(std::vector<RenderObject>& objects) {
+    SDL_Renderer* sdl_renderer = sdl_get_renderer(_context);
 
-    // Render sorted objects
-    ConfigColorRGBA current_color = {0, 0, 0, 0};
-    for (const auto& obj : render_objects) {
-        if (!(obj.color == current_color)) {
-            current_color = obj.color;
-            SDL_SetRenderDrawColor(sdl_get_renderer(_context), current_color.r, current_color.g,
-                                   current_color.b, current_color.a);
+    // Group objects by color so each color becomes one contiguous run.
+    radix_sort_by_color(objects, _sort_scratch);
+
+    // Submit each run of same-colored objects as a single SDL_RenderFillRects batch.
+    std::size_t run_start = 0;
+    while (run_start < objects.size()) {
+        const ConfigColorRGBA run_color = objects[run_start].color;
+        _batch_rects.clear();
+        std::size_t run_end = run_start;
+        while (run_end < objects.size() && objects[run_end] == objects[run_start]) {
+            _batch_rects.push_back(objects[run_end].rect);
+            ++run_end;
         }
-        SDL_RenderFillRect(sdl_get_renderer(_context), &obj.rect);
-    }
 
-    SDL_RenderPresent(sdl_get_renderer(_context));
+        SDL_SetRenderDrawColor(sdl_renderer, run_color.r, run_color.g, run_color.b, run_color.a);
+        SDL_RenderFillRects(sdl_renderer, _batch_rects.data(), static_cast<int>(_batch_rects.size()));
+        ++_draw_calls;
+        run_start = run_end;
+    }
 }
 
 void Renderer::UpdateWindowTitle(int score, int fps) {
@@ -166,7 +335,7 @@ void Renderer::UpdateWindowTitle(int score, int fps) {
 }
 
 void Renderer::AddCharacterObjects(std::vector<RenderObject>& objects, Renderer::ObjectType ot,
-                                   Character::Direction d, int posX, int posY) {
+                                   Character::Direction d, float posX, float posY) {
     auto makeBlock = [&](float x, float y, float w, float h) -> SDL_FRect {
         return SDL_FRect{x, y, w, h};
     };
@@ -236,6 +405,8 @@ void Renderer::RefreshRenderConfig() {
     _player_eye_color = config_get_rgba(&_config, "colors", "player_eye_color", {0, 0, 255, 255});
     _enemy_color = config_get_rgba(&_config, "colors", "enemy_color", {170, 170, 0, 255});
     _enemy_eye_color = config_get_rgba(&_config, "colors", "enemy_eye_color", {0, 0, 255, 255});
+    _projectile_color =
+        config_get_rgba(&_config, "colors", "projectile_color", {255, 255, 255, 255});
 
     _eye_offset_x = config_get_int(&_config, "character", "eye_offset_x", EYE_OFFSET_X);
     _eye_offset_y = config_get_int(&_config, "character", "eye_offset_y", EYE_OFFSET_Y);
@@ -1,6 +1,8 @@
 #ifndef RENDERER_H
 #define RENDERER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,22 +12,13 @@
 #include "character.h"
 #include "gamemap.h"
 class Player;
-class Enemy;
+class EnemyStore;
+class ProjectilePool;
 
 struct RenderObject {
     SDL_FRect rect;
     ConfigColorRGBA color;
 
-    bool operator<(const RenderObject& other) const {
-        if (color.r != other.color.r)
-            return color.r < other.color.r;
-        if (color.g != other.color.g)
-            return color.g < other.color.g;
-        if (color.b != other.color.b)
-            return color.b < other.color.b;
-        return color.a < other.color.a;
-    }
-
     bool operator==(const RenderObject& other) const {
         return color.r == other.color.r && color.g == other.color.g && color.b == other.color.b &&
                color.a == other.color.a;
@@ -39,14 +32,37 @@ class Renderer {
              std::shared_ptr<GameMap> map_ptr, SDLContext* context, const std::string& config_path);
     ~Renderer();
 
-    void Render(Player& player, const Enemy& enemy);
+    // `alpha` in [0, 1] is the fraction of the current simulation tick that has elapsed;
+    // characters are drawn interpolated between their previous and current positions.
+    void Render(const Player& player, const EnemyStore& enemies,
+                const ProjectilePool& projectiles, float alpha);
     void UpdateWindowTitle(int score, int fps);
 
+    // Number of SDL draw submissions issued by the last Render() call.
+    std::size_t LastFrameDrawCalls() const { return _draw_calls; }
+
+    // Frames after the first in which one of the render buffers below had to grow. Only those
+    // buffers are tracked, not every heap allocation (SDL's own allocations are invisible here).
+    // Expected to stay zero; debug builds assert on it.
+    std::size_t SteadyStateBufferGrowths() const { return _steady_state_buffer_growths; }
+
    private:
     void RefreshRenderConfig();
 
+    void AddCellObjects(std::vector<RenderObject>& objects, int row, int col) const;
+
+    void AddMapObjects(std::vector<RenderObject>& objects) const;
+
+    // Re-rasterizes cells changed since the last frame into `_static_layer`.
+    // Returns false when no cached layer is available and the map must be drawn directly.
+    bool UpdateStaticLayer();
+
+    void DrawObjects(std::vector<RenderObject>& objects);
+
+    std::size_t RenderBufferCapacity() const;
+
     void AddCharacterObjects(std::vector<RenderObject>& objects, ObjectType ot,
-                             Character::Direction d, int posX, int posY);
+                             Character::Direction d, float posX, float posY);
 
     SDLContext* _context;
     ConfigManager _config;
@@ -58,12 +74,32 @@ class Renderer {
     const int _grid_height;
     const int _grid_size;
 
+    // Retained map layer. Only cells reported by GameMap::CollectChangedCells are redrawn.
+    SDL_Texture* _static_layer{nullptr};
+    bool _static_layer_unavailable{false};
+    bool _static_layer_valid{false};
+    std::uint64_t _static_layer_revision{0};
+    std::vector<GameMap::CellCoord> _changed_cells;
+
+    // Frame arena: render lists are owned here and reused so steady-state frames don't allocate.
+    // `_render_objects` holds per-frame characters, `_map_objects` cells being rasterized, and
+    // `_batch_rects` one same-color run for SDL_RenderFillRects, `_sort_scratch` the radix sort's
+    // ping-pong buffer.
+    std::vector<RenderObject> _render_objects;
+    std::vector<RenderObject> _map_objects;
+    std::vector<SDL_FRect> _batch_rects;
+    std::vector<RenderObject> _sort_scratch;
+    std::size_t _draw_calls{0};
+    std::size_t _frames_rendered{0};
+    std::size_t _steady_state_buffer_growths{0};
+
     ConfigColorRGBA _wall_color;
     ConfigColorRGBA _floor_color;
     ConfigColorRGBA _player_color;
     ConfigColorRGBA _player_eye_color;
     ConfigColorRGBA _enemy_color;
     ConfigColorRGBA _enemy_eye_color;
+    ConfigColorRGBA _projectile_color;
 
     int _eye_offset_x;
     int _eye_offset_y;
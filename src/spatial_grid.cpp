@@ -0,0 +1,46 @@
+#include "spatial_grid.h"
+
+SpatialGrid::SpatialGrid(int rows, int cols, int grid_size)
+    : _rows(std::max(rows, 1)), _cols(std::max(cols, 1)), _grid_size(std::max(grid_size, 1)) {
+    _cell_start.assign(static_cast<std::size_t>(_rows) * _cols + 1, 0);
+}
+
+void SpatialGrid::Begin(std::size_t count) {
+    _x.resize(count);
+    _y.resize(count);
+    _item_cell.assign(count, -1);
+    _items.resize(count);
+    std::fill(_cell_start.begin(), _cell_start.end(), 0);
+}
+
+void SpatialGrid::Insert(std::size_t id, int x, int y) {
+    const int cell = ClampedCell(x, y);
+    _x[id] = x;
+    _y[id] = y;
+    _item_cell[id] = cell;
+    ++_cell_start[cell + 1];
+}
+
+void SpatialGrid::Finish() {
+    // Prefix sums turn per-cell counts into bucket offsets; a second pass places ids in order.
+    for (std::size_t cell = 1; cell < _cell_start.size(); ++cell) {
+        _cell_start[cell] += _cell_start[cell - 1];
+    }
+    for (std::size_t id = 0; id < _item_cell.size(); ++id) {
+        const int cell = _item_cell[id];
+        if (cell >= 0) {
+            _items[_cell_start[cell]++] = static_cast<std::uint32_t>(id);
+        }
+    }
+    // Placement advanced every offset to the next bucket's start; shift them back.
+    for (std::size_t cell = _cell_start.size() - 1; cell > 0; --cell) {
+        _cell_start[cell] = _cell_start[cell - 1];
+    }
+    _cell_start[0] = 0;
+}
+
+int SpatialGrid::ClampedCell(int x, int y) const {
+    const int row = std::clamp(FloorCell(y), 0, _rows - 1);
+    const int col = std::clamp(FloorCell(x), 0, _cols - 1);
+    return row * _cols + col;
+}
@@ -0,0 +1,71 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Uniform broadphase grid whose buckets are the GameMap cells (`grid_size` pixels square).
+// Characters are grid_size squares; each is filed under the cell holding its top-left corner,
+// so a query only needs to widen its cell range by one cell up and to the left.
+//
+// Buckets are rebuilt every tick with a counting sort into one flat array: no per-cell lists,
+// no allocation once the item count stops growing, and ids within a cell stay in ascending
+// order so iteration is deterministic.
+class SpatialGrid {
+   public:
+    SpatialGrid(int rows, int cols, int grid_size);
+
+    // Starts a rebuild for ids [0, count). Follow with Insert() for every id to file, then
+    // Finish(); ids that are never inserted (e.g. dead characters) are left out.
+    void Begin(std::size_t count);
+
+    void Insert(std::size_t id, int x, int y);
+
+    void Finish();
+
+    // Calls `fn(id)` for every filed character whose square overlaps the rectangle
+    // [x, x + width) x [y, y + height). Stops early when `fn` returns true.
+    template <typename Fn>
+    void ForEachOverlap(int x, int y, int width, int height, Fn&& fn) const {
+        // Off-map items are filed in the nearest edge cell, so the range is clamped the same way.
+        const int first_row = std::clamp(FloorCell(y) - 1, 0, _rows - 1);
+        const int first_col = std::clamp(FloorCell(x) - 1, 0, _cols - 1);
+        const int last_row = std::clamp(FloorCell(y + height - 1), 0, _rows - 1);
+        const int last_col = std::clamp(FloorCell(x + width - 1), 0, _cols - 1);
+        for (int row = first_row; row <= last_row; ++row) {
+            for (int col = first_col; col <= last_col; ++col) {
+                const int cell = row * _cols + col;
+                for (std::uint32_t i = _cell_start[cell]; i < _cell_start[cell + 1]; ++i) {
+                    const std::uint32_t id = _items[i];
+                    if (_x[id] < x + width && x < _x[id] + _grid_size && _y[id] < y + height &&
+                        y < _y[id] + _grid_size && fn(static_cast<std::size_t>(id))) {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+   private:
+    int FloorCell(int value) const {
+        return value >= 0 ? value / _grid_size : -((_grid_size - 1 - value) / _grid_size);
+    }
+
+    int ClampedCell(int x, int y) const;
+
+    int _rows;
+    int _cols;
+    int _grid_size;
+
+    // Positions and bucket of every id in the current build; -1 when not filed.
+    std::vector<int> _x;
+    std::vector<int> _y;
+    std::vector<int> _item_cell;
+    // Bucket `c` holds _items[_cell_start[c] .. _cell_start[c + 1]).
+    std::vector<std::uint32_t> _cell_start;
+    std::vector<std::uint32_t> _items;
+};
+
+#endif  // SPATIAL_GRID_H
@@ -0,0 +1,175 @@
+#include "visibility.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+// Octant transforms for shadowcasting: (dx, dy) in octant space maps to
+// (col + dx * xx + dy * xy, row + dx * yx + dy * yy).
+constexpr int kOctantXX[8] = {1, 0, 0, -1, -1, 0, 0, 1};
+constexpr int kOctantXY[8] = {0, 1, -1, 0, 0, -1, 1, 0};
+constexpr int kOctantYX[8] = {0, 1, 1, 0, 0, -1, -1, 0};
+constexpr int kOctantYY[8] = {1, 0, 0, 1, -1, 0, 0, -1};
+
+void set_bit(std::uint64_t* bits, int index) {
+    bits[index / 64] |= std::uint64_t{1} << (index % 64);
+}
+
+bool test_bit(const std::uint64_t* bits, int index) {
+    return (bits[index / 64] >> (index % 64)) & 1u;
+}
+}  // namespace
+
+Visibility::Visibility(int rows, int cols, int cached_views)
+    : _rows(std::max(rows, 0)), _cols(std::max(cols, 0)), _view_words((_rows * _cols + 63) / 64) {
+    const std::size_t slots = static_cast<std::size_t>(std::max(cached_views, 1));
+    _views.assign(slots * static_cast<std::size_t>(_view_words), 0);
+    _slot_source.assign(slots, kNoSource);
+    _slot_last_used.assign(slots, 0);
+}
+
+void Visibility::Sync(const GameMap& map) {
+    if (_synced && map.Revision() == _synced_revision) {
+        return;
+    }
+
+    _changed_cells.clear();
+    if (!_synced || !map.CollectChangedCells(_synced_revision, &_changed_cells)) {
+        std::fill(_slot_source.begin(), _slot_source.end(), kNoSource);
+    } else {
+        const std::size_t slots = _slot_source.size();
+        for (const GameMap::CellCoord& cell : _changed_cells) {
+            const int changed = cell.row * _cols + cell.col;
+            for (std::size_t slot = 0; slot < slots; ++slot) {
+                if (_slot_source[slot] != kNoSource &&
+                    test_bit(&_views[slot * _view_words], changed)) {
+                    _slot_source[slot] = kNoSource;
+                }
+            }
+        }
+    }
+
+    _synced = true;
+    _synced_revision = map.Revision();
+}
+
+bool Visibility::IsVisible(const GameMap& map, GameMap::CellCoord from, GameMap::CellCoord to) {
+    if (!IsInBounds(from.row, from.col) || !IsInBounds(to.row, to.col)) {
+        return false;
+    }
+
+    const int slot = AcquireView(map, from.row * _cols + from.col);
+    return test_bit(&_views[static_cast<std::size_t>(slot) * _view_words],
+                    to.row * _cols + to.col);
+}
+
+int Visibility::AcquireView(const GameMap& map, int source) {
+    // The cache is a handful of slots, so a linear scan beats any index structure.
+    int victim = 0;
+    const int slots = static_cast<int>(_slot_source.size());
+    for (int slot = 0; slot < slots; ++slot) {
+        if (_slot_source[slot] == source) {
+            _slot_last_used[slot] = ++_use_clock;
+            return slot;
+        }
+        if (_slot_source[victim] != kNoSource &&
+            (_slot_source[slot] == kNoSource ||
+             _slot_last_used[slot] < _slot_last_used[victim])) {
+            victim = slot;
+        }
+    }
+
+    ComputeView(map, source, &_views[static_cast<std::size_t>(victim) * _view_words]);
+    _slot_source[victim] = source;
+    _slot_last_used[victim] = ++_use_clock;
+    return victim;
+}
+
+bool Visibility::RayIsClear(const GameMap& map, GameMap::CellCoord from,
+                            GameMap::CellCoord to) const {
+    int col = from.col;
+    int row = from.row;
+    const int d_col = std::abs(to.col - from.col);
+    const int d_row = -std::abs(to.row - from.row);
+    const int step_col = from.col < to.col ? 1 : -1;
+    const int step_row = from.row < to.row ? 1 : -1;
+    int error = d_col + d_row;
+    while (true) {
+        if (col == to.col && row == to.row) {
+            return true;
+        }
+        const int doubled = 2 * error;
+        if (doubled >= d_row) {
+            error += d_row;
+            col += step_col;
+        }
+        if (doubled <= d_col) {
+            error += d_col;
+            row += step_row;
+        }
+        if ((col != to.col || row != to.row) && !map.AreaIsAvailable(row, col)) {
+            return false;
+        }
+    }
+}
+
+void Visibility::ComputeView(const GameMap& map, int source, std::uint64_t* view) {
+    std::fill(view, view + _view_words, 0);
+    set_bit(view, source);
+
+    const int row = source / _cols;
+    const int col = source % _cols;
+    for (int octant = 0; octant < 8; ++octant) {
+        CastLight(map, view, row, col, 1, 1.0, 0.0, kOctantXX[octant], kOctantXY[octant],
+                  kOctantYX[octant], kOctantYY[octant]);
+    }
+    ++_computed_views;
+}
+
+void Visibility::CastLight(const GameMap& map, std::uint64_t* view, int source_row,
+                           int source_col, int distance, double start_slope, double end_slope,
+                           int xx, int xy, int yx, int yy) const {
+    if (start_slope < end_slope) {
+        return;
+    }
+
+    const int radius = std::max(_rows, _cols);
+    double next_start_slope = start_slope;
+    for (int depth = distance; depth <= radius; ++depth) {
+        bool blocked = false;
+        for (int dx = -depth, dy = -depth; dx <= 0; ++dx) {
+            const double left_slope = (dx - 0.5) / (dy + 0.5);
+            const double right_slope = (dx + 0.5) / (dy - 0.5);
+            if (start_slope < right_slope) {
+                continue;
+            }
+            if (end_slope > left_slope) {
+                break;
+            }
+
+            const int col = source_col + dx * xx + dy * xy;
+            const int row = source_row + dx * yx + dy * yy;
+            const bool in_bounds = IsInBounds(row, col);
+            if (in_bounds) {
+                set_bit(view, row * _cols + col);
+            }
+            // Out-of-bounds cells block sight like walls.
+            const bool opaque = !in_bounds || !map.AreaIsAvailable(row, col);
+            if (blocked) {
+                if (opaque) {
+                    next_start_slope = right_slope;
+                    continue;
+                }
+                blocked = false;
+                start_slope = next_start_slope;
+            } else if (opaque && depth < radius) {
+                blocked = true;
+                CastLight(map, view, source_row, source_col, depth + 1, start_slope, left_slope,
+                          xx, xy, yx, yy);
+                next_start_slope = right_slope;
+            }
+        }
+        if (blocked) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef VISIBILITY_H
+#define VISIBILITY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "gamemap.h"
+
+// Line-of-sight queries over GameMap cells, where any cell that is not walkable blocks sight.
+// IsVisible() uses recursive shadowcasting and keeps the full field of view of the most
+// recently queried source cells as bitsets in a small LRU cache, so repeated queries from the
+// same cell are a single bit test and memory stays bounded by the cache size rather than the
+// number of cells. Sync() reads the map's change log and drops only the cached views in which a
+// changed cell was visible; cells hidden from a source cannot alter what that source sees.
+//
+// As with any plain shadowcasting, views are not strictly symmetric. Callers checking whether
+// many observers see one target should query from the target's cell, which needs one view.
+class Visibility {
+   public:
+    // Cached fields of view when the constructor is not given a count.
+    static constexpr int kDefaultCachedViews = 16;
+
+    Visibility(int rows, int cols, int cached_views = kDefaultCachedViews);
+
+    // Invalidates cached views affected by map changes since the last call.
+    void Sync(const GameMap& map);
+
+    // True if `to` lies in the shadowcast field of view from `from`. Blocking cells are
+    // themselves visible, and every cell sees itself.
+    bool IsVisible(const GameMap& map, GameMap::CellCoord from, GameMap::CellCoord to);
+
+    // True if the Bresenham line between the two cells crosses no blocking cell; the endpoints
+    // themselves are not tested. Uncached, O(distance).
+    bool RayIsClear(const GameMap& map, GameMap::CellCoord from, GameMap::CellCoord to) const;
+
+    // Number of fields of view computed so far, for profiling the cache.
+    std::uint64_t ComputedViewCount() const { return _computed_views; }
+
+    // Maximum number of source cells whose views are cached at once.
+    int CachedViewCapacity() const { return static_cast<int>(_slot_source.size()); }
+
+   private:
+    bool IsInBounds(int row, int col) const {
+        return row >= 0 && col >= 0 && row < _rows && col < _cols;
+    }
+
+    // Cache slot holding the view from `source`, computing it into the least recently used
+    // slot on a miss.
+    int AcquireView(const GameMap& map, int source);
+
+    void ComputeView(const GameMap& map, int source, std::uint64_t* view);
+
+    void CastLight(const GameMap& map, std::uint64_t* view, int source_row, int source_col,
+                   int distance, double start_slope, double end_slope, int xx, int xy, int yx,
+                   int yy) const;
+
+    int _rows;
+    int _cols;
+    int _view_words;
+    bool _synced{false};
+    std::uint64_t _synced_revision{0};
+    std::uint64_t _computed_views{0};
+    std::uint64_t _use_clock{0};
+
+    // Visible-cell bitset per cache slot, _view_words each. A slot's source cell is kNoSource
+    // while it is empty or invalidated; _slot_last_used orders slots for eviction.
+    static constexpr int kNoSource = -1;
+    std::vector<std::uint64_t> _views;
+    std::vector<int> _slot_source;
+    std::vector<std::uint64_t> _slot_last_used;
+    std::vector<GameMap::CellCoord> _changed_cells;
+};
+
+#endif  // VISIBILITY_H
@@ -0,0 +1,80 @@
+#include "worker_pool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(std::size_t thread_count) {
+    _threads.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+        _threads.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _work_ready.notify_all();
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::ParallelFor(std::size_t count, std::size_t chunk_size, const RangeFunction& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (_threads.empty() || count <= chunk_size) {
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &fn;
+        _job_count = count;
+        _job_chunk = std::max<std::size_t>(chunk_size, 1);
+        _next_index.store(0, std::memory_order_relaxed);
+        _busy_workers = _threads.size();
+        ++_generation;
+    }
+    _work_ready.notify_all();
+
+    RunChunks();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _work_done.wait(lock, [this] { return _busy_workers == 0; });
+    _job = nullptr;
+}
+
+void WorkerPool::RunChunks() {
+    while (true) {
+        const std::size_t begin = _next_index.fetch_add(_job_chunk, std::memory_order_relaxed);
+        if (begin >= _job_count) {
+            return;
+        }
+        (*_job)(begin, std::min(begin + _job_chunk, _job_count));
+    }
+}
+
+void WorkerPool::WorkerLoop() {
+    std::uint64_t seen_generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _work_ready.wait(lock,
+                             [&] { return _stopping || _generation != seen_generation; });
+            if (_stopping) {
+                return;
+            }
+            seen_generation = _generation;
+        }
+
+        RunChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_busy_workers;
+        }
+        _work_done.notify_one();
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent pool of worker threads, created once and reused every tick. ParallelFor splits an
+// index range into chunks that the workers and the calling thread claim until it is exhausted.
+class WorkerPool {
+   public:
+    using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+    // `thread_count` extra workers are started; 0 runs everything on the calling thread.
+    explicit WorkerPool(std::size_t thread_count);
+
+    WorkerPool(const WorkerPool& source) = delete;
+
+    WorkerPool& operator=(const WorkerPool& source) = delete;
+
+    ~WorkerPool();
+
+    std::size_t ThreadCount() const { return _threads.size(); }
+
+    // Calls `fn` on disjoint [begin, end) sub-ranges covering [0, count) and returns once all of
+    // them have finished. Not reentrant: only one ParallelFor may run at a time.
+    void ParallelFor(std::size_t count, std::size_t chunk_size, const RangeFunction& fn);
+
+   private:
+    void WorkerLoop();
+
+    void RunChunks();
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _work_ready;
+    std::condition_variable _work_done;
+    std::uint64_t _generation{0};
+    std::size_t _busy_workers{0};
+    bool _stopping{false};
+
+    // Current job; only valid while a ParallelFor call is in flight.
+    const RangeFunction* _job{nullptr};
+    std::size_t _job_count{0};
+    std::size_t _job_chunk{1};
+    std::atomic<std::size_t> _next_index{0};
+};
+
+#endif  // WORKER_POOL_H
@@ -0,0 +1,132 @@
+/**
+ * AICentral Knowledge Grid Unit Tests
+ *
+ * Checks the 2-bit packing (32 cells per word, each row starting on a new word) with column
+ * counts that do not divide by 32, RevealSpan across word boundaries and ExploredCount.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "AICentral.h"
+#include "utils/test_maps.h"
+
+namespace {
+using MapObject = AICentral::MapObject;
+
+// Walls on every fifth column plus the diagonal, so spans see both values in every word.
+std::vector<std::string> striped_layout(int rows, int cols) {
+    std::vector<std::string> layout(rows, std::string(cols, '.'));
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            if (col % 5 == 0 || col == row) {
+                layout[row][col] = '#';
+            }
+        }
+    }
+    return layout;
+}
+}  // namespace
+
+// ===== Packing Tests =====
+
+class AICentralPackingTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(AICentralPackingTest, CellsStartDarkAndStoreEachValue) {
+    const int cols = GetParam();
+    constexpr int kRows = 3;
+    AICentral ai(kRows, cols);
+    EXPECT_EQ(ai.ExploredCount(), 0);
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            ASSERT_EQ(ai.ReadFromMap(row, col), MapObject::kDark);
+        }
+    }
+
+    // Write a repeating pattern and read it back; neighbouring cells and rows must not bleed.
+    const MapObject values[] = {MapObject::kRoad, MapObject::kWall, MapObject::kDark};
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            ai.AddToMap(row, col, values[(row + col) % 3]);
+        }
+    }
+    int explored = 0;
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            ASSERT_EQ(ai.ReadFromMap(row, col), values[(row + col) % 3]) << row << "," << col;
+            explored += (row + col) % 3 != 2 ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(ai.ExploredCount(), explored);
+}
+
+TEST_P(AICentralPackingTest, OutOfBoundsReadsAsWallAndIgnoresWrites) {
+    const int cols = GetParam();
+    AICentral ai(2, cols);
+    ai.AddToMap(0, cols, MapObject::kRoad);
+    ai.AddToMap(-1, 0, MapObject::kRoad);
+    ai.AddToMap(2, 0, MapObject::kRoad);
+
+    EXPECT_EQ(ai.ReadFromMap(0, cols), MapObject::kWall);
+    EXPECT_EQ(ai.ReadFromMap(0, -1), MapObject::kWall);
+    EXPECT_EQ(ai.ReadFromMap(2, 0), MapObject::kWall);
+    EXPECT_EQ(ai.ReadFromMap(1, cols - 1), MapObject::kDark);
+    EXPECT_EQ(ai.ExploredCount(), 0);
+}
+
+// ===== RevealSpan Tests =====
+
+TEST_P(AICentralPackingTest, RevealSpanChartsExactlyTheClippedSpan) {
+    const int cols = GetParam();
+    constexpr int kRows = 4;
+    const auto map = make_test_map(striped_layout(kRows, cols));
+    AICentral ai(kRows, cols);
+
+    // Crosses the first word boundary where the row is wide enough and runs past the last column.
+    const int begin = cols / 2 - 3;
+    ai.RevealSpan(*map, 1, begin, cols + 10);
+    ai.RevealSpan(*map, 2, -5, 3);
+    ai.RevealSpan(*map, -1, 0, cols);
+    ai.RevealSpan(*map, kRows, 0, cols);
+
+    int explored = 0;
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            const bool revealed = (row == 1 && col >= begin) || (row == 2 && col < 3);
+            const MapObject expected = !revealed                        ? MapObject::kDark
+                                       : map->AreaIsAvailable(row, col) ? MapObject::kRoad
+                                                                        : MapObject::kWall;
+            ASSERT_EQ(ai.ReadFromMap(row, col), expected) << row << "," << col;
+            explored += revealed ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(ai.ExploredCount(), explored);
+}
+
+TEST_P(AICentralPackingTest, RevealSpanOverwritesEarlierKnowledge) {
+    const int cols = GetParam();
+    const auto map = make_test_map(striped_layout(1, cols));
+    AICentral ai(1, cols);
+    for (int col = 0; col < cols; ++col) {
+        ai.AddToMap(0, col, MapObject::kWall);
+    }
+
+    ai.RevealSpan(*map, 0, 0, cols);
+    for (int col = 0; col < cols; ++col) {
+        EXPECT_EQ(ai.ReadFromMap(0, col),
+                  map->AreaIsAvailable(0, col) ? MapObject::kRoad : MapObject::kWall);
+    }
+    EXPECT_EQ(ai.ExploredCount(), cols);
+}
+
+TEST_P(AICentralPackingTest, EmptySpanChangesNothing) {
+    const int cols = GetParam();
+    const auto map = make_test_map(striped_layout(1, cols));
+    AICentral ai(1, cols);
+
+    ai.RevealSpan(*map, 0, 5, 5);
+    ai.RevealSpan(*map, 0, 7, 2);
+    EXPECT_EQ(ai.ExploredCount(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ColumnCounts, AICentralPackingTest,
+                         ::testing::Values(1, 31, 32, 33, 37, 64, 95));
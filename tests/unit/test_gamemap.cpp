@@ -0,0 +1,186 @@
+/**
+ * GameMap Loading Unit Tests
+ *
+ * Covers the text map token parser (legacy, packed and legacy extended tokens, including the
+ * strtol/strtoul edge cases it mirrors) and picking the format from the file's magic bytes.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include "gamemap.h"
+#include "tempmap.h"
+#include "utils/test_maps.h"
+
+namespace {
+// Packed token with the same entry for all 16 subtiles.
+std::string packed_token(const std::string& material, const std::string& entry) {
+    std::string token = material + "|";
+    for (int i = 0; i < GameMap::kSubtilesPerCell; ++i) {
+        token += (i == 0 ? "" : ",") + entry;
+    }
+    return token;
+}
+
+// Loads a single-cell map from `token`.
+std::shared_ptr<GameMap> load_token(const std::string& token) {
+    return load_text_map(token + "\n", 1, 1);
+}
+
+bool is_plain_wall(const GameMap& map) {
+    return map.RowCount() == 1 && map.ColCount() == 1 && map.GetCellMaterial(0, 0) == 1 &&
+           !map.HasDestructibleSubtiles(0, 0);
+}
+}  // namespace
+
+// ===== Legacy Token Tests =====
+
+TEST(GameMapParserTest, LegacyTokensFollowStrtol) {
+    EXPECT_EQ(load_token("0")->GetCellMaterial(0, 0), 0);
+    EXPECT_EQ(load_token("-0")->GetCellMaterial(0, 0), 0);
+    EXPECT_EQ(load_token("+0")->GetCellMaterial(0, 0), 0);
+    EXPECT_EQ(load_token("000")->GetCellMaterial(0, 0), 0);
+    EXPECT_EQ(load_token("7")->GetCellMaterial(0, 0), 1);
+    // Anything strtol does not consume entirely is a wall.
+    EXPECT_EQ(load_token("0x0")->GetCellMaterial(0, 0), 1);
+    EXPECT_EQ(load_token("-")->GetCellMaterial(0, 0), 1);
+    EXPECT_EQ(load_token("0a")->GetCellMaterial(0, 0), 1);
+    EXPECT_EQ(load_token("99999999999999999999999")->GetCellMaterial(0, 0), 1);
+}
+
+// ===== Packed Token Tests =====
+
+TEST(GameMapParserTest, PackedEntriesAcceptDecimalHexAndOctal) {
+    const auto hex = load_token(packed_token("1", "0x0B2A"));
+    ASSERT_TRUE(hex->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(hex->GetSubtileId(0, 0, 5), 0x2A);
+    EXPECT_EQ(hex->GetSubtileHealth(0, 0, 5), 3);
+
+    const auto decimal = load_token(packed_token("1", "2858"));  // 0x0B2A
+    ASSERT_TRUE(decimal->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(decimal->GetSubtileId(0, 0, 0), 0x2A);
+
+    const auto octal = load_token(packed_token("1", "010"));  // 8
+    ASSERT_TRUE(octal->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(octal->GetSubtileId(0, 0, 15), 8);
+
+    const auto zero = load_token(packed_token("0", "-0"));
+    ASSERT_TRUE(zero->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(zero->GetSubtileId(0, 0, 3), 0);
+    EXPECT_TRUE(zero->AreaIsAvailable(0, 0));
+}
+
+TEST(GameMapParserTest, MalformedPackedEntriesMakeAPlainWall) {
+    // "0x" and "08" are only partly consumed by strtoul(..., 0): "0" then 'x' or '8'.
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "0x"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "08"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "0x10000"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "65536"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "-1"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", "0x+1"))));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("0", ""))));
+    EXPECT_TRUE(is_plain_wall(*load_token("0|0,0,0")));
+}
+
+TEST(GameMapParserTest, OversizedMaterialSaturatesLikeStrtol) {
+    // strtol saturates rather than failing, so the token still parses with its subtiles; the
+    // material is whatever the saturated long narrows to (LONG_MIN becomes 0 on LP64).
+    for (const char* material : {"99999999999999999999999", "-99999999999999999999999"}) {
+        const auto map = load_token(packed_token(material, "0x0000"));
+        const int narrowed = static_cast<int>(std::strtol(material, nullptr, 10));
+        EXPECT_EQ(map->GetCellMaterial(0, 0), narrowed == 0 ? 0 : 1) << material;
+        EXPECT_TRUE(map->HasDestructibleSubtiles(0, 0)) << material;
+    }
+}
+
+TEST(GameMapParserTest, TrailingSeparatorsAreIgnoredLikeGetline) {
+    // A final '|' or ',' does not start an empty field.
+    const auto trailing_bar = load_token(packed_token("1", "0x0B01") + "|");
+    EXPECT_TRUE(trailing_bar->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(trailing_bar->GetSubtileId(0, 0, 15), 1);
+
+    const auto trailing_comma = load_token(packed_token("1", "0x0B01") + ",");
+    EXPECT_TRUE(trailing_comma->HasDestructibleSubtiles(0, 0));
+
+    // A bare material with a trailing '|' has no subtile field at all.
+    EXPECT_TRUE(is_plain_wall(*load_token("0|")));
+    EXPECT_TRUE(is_plain_wall(*load_token(packed_token("1", "0x0B01") + "||")));
+}
+
+// ===== Legacy Extended Token Tests =====
+
+TEST(GameMapParserTest, LegacyExtendedTokensSetHealthFromTheMask) {
+    const auto map = load_token("1|1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16|3");
+    ASSERT_TRUE(map->HasDestructibleSubtiles(0, 0));
+    EXPECT_EQ(map->GetSubtileId(0, 0, 15), 16);
+    EXPECT_EQ(map->GetSubtileHealth(0, 0, 0), 0);
+    EXPECT_EQ(map->GetSubtileHealth(0, 0, 1), 0);
+    EXPECT_EQ(map->GetSubtileHealth(0, 0, 2), 1);
+
+    EXPECT_TRUE(is_plain_wall(*load_token("1|1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16|65536")));
+    EXPECT_TRUE(is_plain_wall(*load_token("1|1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,256|0")));
+}
+
+// ===== Layout Tests =====
+
+TEST(GameMapParserTest, BlankLinesAndExtraWhitespaceAreSkipped) {
+    const auto map = load_text_map("\n 0\t1  0 \r\n\n\n1 0 1\n   \n", 2, 3);
+    EXPECT_TRUE(map->MatchesDimensions(2, 3));
+    EXPECT_TRUE(map->AreaIsAvailable(0, 0));
+    EXPECT_FALSE(map->AreaIsAvailable(0, 1));
+    EXPECT_FALSE(map->AreaIsAvailable(1, 0));
+}
+
+TEST(GameMapParserTest, RaggedRowsAreNotUniform) {
+    const auto map = load_text_map("0 0 0\n0 0\n", 2, 3);
+    EXPECT_FALSE(map->MatchesDimensions(2, 3));
+    EXPECT_EQ(map->ColCount(), 3);
+}
+
+// ===== File Format Tests =====
+
+TEST(GameMapLoadTest, EmbeddedHeaderIsSkipped) {
+    std::string contents(64, '\0');
+    contents.replace(0, 4, "MMD1");
+    contents += "0 1\n1 0\n";
+    const auto map = load_text_map(contents, 2, 2);
+    EXPECT_TRUE(map->MatchesDimensions(2, 2));
+    EXPECT_TRUE(map->AreaIsAvailable(0, 0));
+    EXPECT_FALSE(map->AreaIsAvailable(0, 1));
+}
+
+TEST(GameMapLoadTest, EmptyFileIsAnEmptyMap) {
+    const auto map = load_text_map("", 0, 0);
+    EXPECT_EQ(map->RowCount(), 0);
+}
+
+TEST(GameMapLoadTest, MissingFileUsesTheBuiltInMap) {
+    const GameMap map(20, 32, TEST_GRID_SIZE, "/nonexistent/playgame_test.map", 0);
+    ASSERT_TRUE(map.MatchesDimensions(static_cast<int>(tempgamemap.size()),
+                                      static_cast<int>(tempgamemap[0].size())));
+    for (int row = 0; row < map.RowCount(); ++row) {
+        for (int col = 0; col < map.ColCount(); ++col) {
+            EXPECT_EQ(map.GetCellMaterial(row, col), tempgamemap[row][col] == 0 ? 0 : 1);
+        }
+    }
+}
+
+TEST(GameMapLoadTest, DatabaseRoundTripMatchesTheTextMap) {
+    const auto text_map = make_subtile_map(6, 9, 0.4, 17);
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "playgame_test_roundtrip.db";
+    ASSERT_TRUE(text_map->SaveDatabase(path.string(), "roundtrip"));
+
+    const GameMap db_map(6, 9, TEST_GRID_SIZE, path.string(), 0);
+    EXPECT_TRUE(db_map.MatchesDimensions(6, 9));
+    EXPECT_EQ(db_map.ContentHash(), text_map->ContentHash());
+
+    // A missing record falls back to the built-in map, not to parsing the database as text.
+    const GameMap missing(6, 9, TEST_GRID_SIZE, path.string(), 3);
+    const GameMap built_in(6, 9, TEST_GRID_SIZE, "/nonexistent/playgame_test.map", 0);
+    EXPECT_TRUE(missing.MatchesDimensions(static_cast<int>(tempgamemap.size()),
+                                          static_cast<int>(tempgamemap[0].size())));
+    EXPECT_EQ(missing.ContentHash(), built_in.ContentHash());
+    std::filesystem::remove(path);
+}
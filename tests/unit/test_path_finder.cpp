@@ -0,0 +1,116 @@
+/**
+ * PathFinder Unit Tests
+ *
+ * Checks A* path lengths against a flat BFS, path validity, the failure cases and that queries
+ * after the first one do not allocate.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include "path_finder.h"
+#include "utils/allocation_counter.h"
+#include "utils/test_maps.h"
+
+namespace {
+bool is_valid_path(const GameMap& map, GameMap::CellCoord start, GameMap::CellCoord goal,
+                   const std::vector<GameMap::CellCoord>& path) {
+    GameMap::CellCoord previous = start;
+    for (const GameMap::CellCoord& cell : path) {
+        const int step = std::abs(cell.row - previous.row) + std::abs(cell.col - previous.col);
+        if (step != 1 || !map.AreaIsAvailable(cell.row, cell.col)) {
+            return false;
+        }
+        previous = cell;
+    }
+    return previous.row == goal.row && previous.col == goal.col;
+}
+}  // namespace
+
+// ===== Path Search Tests =====
+
+TEST(PathFinderTest, MatchesBfsOnRandomMaps) {
+    constexpr int kRows = 24;
+    constexpr int kCols = 31;
+    for (std::uint32_t seed = 1; seed <= 8; ++seed) {
+        const auto map = make_test_map(random_layout(kRows, kCols, 0.3, seed));
+        ASSERT_TRUE(map->MatchesDimensions(kRows, kCols));
+        const std::vector<std::uint8_t> walkable = cell_walkability(*map);
+        PathFinder finder(kRows, kCols);
+
+        for (int start = 0; start < kRows * kCols; start += 37) {
+            const std::vector<int> distance = bfs_distances(walkable, kRows, kCols, start);
+            const GameMap::CellCoord from{start / kCols, start % kCols};
+            for (int goal = 0; goal < kRows * kCols; goal += 13) {
+                const GameMap::CellCoord to{goal / kCols, goal % kCols};
+                const bool found = finder.FindPath(*map, from, to);
+                ASSERT_EQ(found, distance[goal] >= 0) << "seed " << seed;
+                if (found) {
+                    EXPECT_EQ(static_cast<int>(finder.Path().size()), distance[goal]);
+                    EXPECT_TRUE(is_valid_path(*map, from, to, finder.Path()));
+                }
+            }
+        }
+    }
+}
+
+TEST(PathFinderTest, RoutesAroundWalls) {
+    const auto map = make_test_map({
+        ".....",
+        "####.",
+        ".....",
+        ".####",
+        ".....",
+    });
+    PathFinder finder(5, 5);
+
+    ASSERT_TRUE(finder.FindPath(*map, {0, 0}, {4, 4}));
+    EXPECT_EQ(finder.Path().size(), 16u);
+    EXPECT_TRUE(is_valid_path(*map, {0, 0}, {4, 4}, finder.Path()));
+}
+
+TEST(PathFinderTest, StartEqualsGoalGivesEmptyPath) {
+    const auto map = make_test_map({"...", "...", "..."});
+    PathFinder finder(3, 3);
+
+    EXPECT_TRUE(finder.FindPath(*map, {1, 1}, {1, 1}));
+    EXPECT_TRUE(finder.Path().empty());
+}
+
+TEST(PathFinderTest, RejectsBlockedOutOfBoundsAndUnreachable) {
+    const auto map = make_test_map({
+        "..#..",
+        "..#..",
+        "..#..",
+    });
+    PathFinder finder(3, 5);
+
+    EXPECT_FALSE(finder.FindPath(*map, {0, 0}, {0, 2}));
+    EXPECT_FALSE(finder.FindPath(*map, {0, 2}, {0, 0}));
+    EXPECT_FALSE(finder.FindPath(*map, {0, 0}, {3, 0}));
+    EXPECT_FALSE(finder.FindPath(*map, {-1, 0}, {0, 0}));
+    EXPECT_FALSE(finder.FindPath(*map, {0, 0}, {2, 4}));
+    EXPECT_TRUE(finder.Path().empty());
+}
+
+// ===== Allocation Tests =====
+
+TEST(PathFinderTest, QueriesAfterTheFirstDoNotAllocate) {
+    constexpr int kRows = 20;
+    constexpr int kCols = 32;
+    const auto map = make_test_map(random_layout(kRows, kCols, 0.2, 42));
+    PathFinder finder(kRows, kCols);
+    finder.FindPath(*map, {0, 0}, {kRows - 1, kCols - 1});
+
+    const std::size_t before = allocation_count();
+    int found = 0;
+    for (int start = 0; start < kRows * kCols; start += 7) {
+        for (int goal = 0; goal < kRows * kCols; goal += 11) {
+            found += finder.FindPath(*map, {start / kCols, start % kCols},
+                                     {goal / kCols, goal % kCols})
+                         ? 1
+                         : 0;
+        }
+    }
+    EXPECT_EQ(allocation_count(), before);
+    EXPECT_GT(found, 0);
+}
@@ -0,0 +1,112 @@
+/**
+ * Projectile Pool Unit Tests
+ *
+ * Covers swept movement that hits a wall a single-step move would jump over, release on
+ * leaving the map, and slot reuse through the free list once the pool is full.
+ */
+
+#include <gtest/gtest.h>
+#include "projectile_pool.h"
+#include "utils/test_maps.h"
+
+namespace {
+const std::vector<std::string> kCorridor = {
+    "........",
+    "..#.....",
+    "........",
+};
+
+// Centre of the middle row's first cell.
+constexpr int kStartX = TEST_GRID_SIZE / 2;
+constexpr int kStartY = TEST_GRID_SIZE + TEST_GRID_SIZE / 2;
+}  // namespace
+
+// ===== Swept Movement Tests =====
+
+TEST(ProjectilePoolTest, FastProjectileHitsTheFirstBlockedSubtileOnItsPath) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 4, map);
+    const std::uint64_t revision = map->Revision();
+
+    // One tick would carry it from column 0 to column 3, straight over the wall in column 2.
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kRight, 3 * TEST_GRID_SIZE));
+    pool.Update();
+
+    EXPECT_EQ(pool.ActiveCount(), 0u);
+    EXPECT_EQ(pool.HitCount(), 1u);
+    EXPECT_NE(map->Revision(), revision);
+    // It stopped on the wall's first subtile column.
+    EXPECT_EQ(pool.GetX(0), 2 * TEST_GRID_SIZE);
+    EXPECT_EQ(pool.GetPrevX(0), kStartX);
+}
+
+TEST(ProjectilePoolTest, ProjectileOverOpenFloorMovesItsFullSpeed) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 4, map);
+
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kUp, 10));
+    pool.Update();
+
+    EXPECT_TRUE(pool.IsActive(0));
+    EXPECT_EQ(pool.GetX(0), kStartX);
+    EXPECT_EQ(pool.GetY(0), kStartY - 10);
+    EXPECT_EQ(pool.HitCount(), 0u);
+}
+
+TEST(ProjectilePoolTest, LeavingTheMapReleasesWithoutAHit) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 4, map);
+    const std::uint64_t revision = map->Revision();
+
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kLeft, TEST_GRID_SIZE));
+    pool.Update();
+
+    EXPECT_EQ(pool.ActiveCount(), 0u);
+    EXPECT_EQ(pool.HitCount(), 0u);
+    EXPECT_EQ(map->Revision(), revision);
+}
+
+// ===== Slot Reuse Tests =====
+
+TEST(ProjectilePoolTest, FullPoolDropsShotsUntilASlotIsReleased) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 2, map);
+
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kUp, 1));
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kDown, 1));
+    EXPECT_TRUE(pool.IsActive(0));
+    EXPECT_TRUE(pool.IsActive(1));
+    EXPECT_FALSE(pool.Spawn(kStartX, kStartY, Character::Direction::kRight, 1));
+    EXPECT_EQ(pool.ActiveCount(), 2u);
+
+    pool.Release(0);
+    pool.Release(0);
+    EXPECT_EQ(pool.ActiveCount(), 1u);
+    ASSERT_TRUE(pool.Spawn(kStartX + 4, kStartY, Character::Direction::kRight, 1));
+    EXPECT_TRUE(pool.IsActive(0));
+    EXPECT_EQ(pool.GetX(0), kStartX + 4);
+    EXPECT_FALSE(pool.Spawn(kStartX, kStartY, Character::Direction::kRight, 1));
+}
+
+TEST(ProjectilePoolTest, RejectedShotsDoNotTakeASlot) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 1, map);
+
+    EXPECT_FALSE(pool.Spawn(kStartX, kStartY, Character::Direction::kNone, 4));
+    EXPECT_FALSE(pool.Spawn(kStartX, kStartY, Character::Direction::kUp, 0));
+    EXPECT_EQ(pool.ActiveCount(), 0u);
+    EXPECT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kUp, 4));
+}
+
+TEST(ProjectilePoolTest, ReleasedSlotsAreReusedAfterAnUpdate) {
+    const auto map = make_test_map(kCorridor);
+    ProjectilePool pool(TEST_GRID_SIZE, 1, map);
+
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kLeft, TEST_GRID_SIZE));
+    pool.Update();
+    ASSERT_EQ(pool.ActiveCount(), 0u);
+
+    ASSERT_TRUE(pool.Spawn(kStartX, kStartY, Character::Direction::kDown, 4));
+    EXPECT_TRUE(pool.IsActive(0));
+    EXPECT_EQ(pool.GetY(0), kStartY);
+}
@@ -0,0 +1,116 @@
+/**
+ * Spatial Grid Unit Tests
+ *
+ * Covers the one-cell widened overlap query, half-open rectangle edges, clamping of off-map
+ * items and queries to the edge cells, and rebuilds that leave out ids never inserted.
+ */
+
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+#include "spatial_grid.h"
+
+namespace {
+constexpr int kRows = 4;
+constexpr int kCols = 5;
+constexpr int kCell = 32;
+
+// Ids reported by ForEachOverlap() for the rectangle, in visiting order.
+std::vector<std::size_t> overlaps(const SpatialGrid& grid, int x, int y, int width, int height) {
+    std::vector<std::size_t> ids;
+    grid.ForEachOverlap(x, y, width, height, [&ids](std::size_t id) {
+        ids.push_back(id);
+        return false;
+    });
+    return ids;
+}
+
+// Files one item per position, with ids in the order given.
+SpatialGrid make_grid(const std::vector<std::pair<int, int>>& positions) {
+    SpatialGrid grid(kRows, kCols, kCell);
+    grid.Begin(positions.size());
+    for (std::size_t id = 0; id < positions.size(); ++id) {
+        grid.Insert(id, positions[id].first, positions[id].second);
+    }
+    grid.Finish();
+    return grid;
+}
+}  // namespace
+
+// ===== Overlap Query Tests =====
+
+TEST(SpatialGridTest, QueryWidensOneCellUpAndLeft) {
+    // Filed under cell (1, 1) by its top-left corner, but its square reaches into cell (2, 2).
+    const SpatialGrid grid = make_grid({{40, 40}});
+
+    EXPECT_EQ(overlaps(grid, 70, 70, 4, 4), std::vector<std::size_t>{0});
+    EXPECT_EQ(overlaps(grid, 65, 40, 4, 4), std::vector<std::size_t>{0});
+    EXPECT_EQ(overlaps(grid, 40, 65, 4, 4), std::vector<std::size_t>{0});
+}
+
+TEST(SpatialGridTest, RectangleEdgesAreHalfOpen) {
+    const SpatialGrid grid = make_grid({{32, 32}});
+
+    EXPECT_TRUE(overlaps(grid, 64, 32, 8, 8).empty());
+    EXPECT_TRUE(overlaps(grid, 32, 64, 8, 8).empty());
+    EXPECT_TRUE(overlaps(grid, 24, 32, 8, 8).empty());
+    EXPECT_EQ(overlaps(grid, 25, 32, 8, 8), std::vector<std::size_t>{0});
+    EXPECT_EQ(overlaps(grid, 63, 63, 8, 8), std::vector<std::size_t>{0});
+}
+
+TEST(SpatialGridTest, IdsWithinACellComeOutInAscendingOrder) {
+    const SpatialGrid grid = make_grid({{10, 10}, {100, 100}, {12, 8}, {4, 20}});
+
+    EXPECT_EQ(overlaps(grid, 0, 0, 32, 32), (std::vector<std::size_t>{0, 2, 3}));
+}
+
+TEST(SpatialGridTest, QueryStopsWhenCallbackReturnsTrue) {
+    const SpatialGrid grid = make_grid({{10, 10}, {12, 8}, {4, 20}});
+
+    std::vector<std::size_t> ids;
+    grid.ForEachOverlap(0, 0, 32, 32, [&ids](std::size_t id) {
+        ids.push_back(id);
+        return id == 1;
+    });
+    EXPECT_EQ(ids, (std::vector<std::size_t>{0, 1}));
+}
+
+// ===== Edge Clamping Tests =====
+
+TEST(SpatialGridTest, OffMapItemsAreFoundFromInsideTheMap) {
+    const int right = kCols * kCell;
+    const int bottom = kRows * kCell;
+    const SpatialGrid grid = make_grid({{-20, 10}, {right - 10, bottom + 5}, {10, -25}});
+
+    EXPECT_EQ(overlaps(grid, 8, 4, 4, 8), (std::vector<std::size_t>{0, 2}));
+    EXPECT_EQ(overlaps(grid, right - 4, bottom + 10, 4, 4), std::vector<std::size_t>{1});
+}
+
+TEST(SpatialGridTest, QueriesBeyondTheEdgeStillFindClampedItems) {
+    const int right = kCols * kCell;
+    const int bottom = kRows * kCell;
+    const SpatialGrid grid = make_grid({{right + 100, bottom + 100}, {-200, -200}});
+
+    EXPECT_EQ(overlaps(grid, right + 110, bottom + 110, 4, 4), std::vector<std::size_t>{0});
+    EXPECT_EQ(overlaps(grid, -190, -190, 4, 4), std::vector<std::size_t>{1});
+    EXPECT_TRUE(overlaps(grid, right + 200, bottom + 200, 4, 4).empty());
+}
+
+// ===== Rebuild Tests =====
+
+TEST(SpatialGridTest, RebuildLeavesOutIdsThatWereNotInserted) {
+    SpatialGrid grid(kRows, kCols, kCell);
+    grid.Begin(3);
+    grid.Insert(0, 10, 10);
+    grid.Insert(1, 12, 12);
+    grid.Insert(2, 14, 14);
+    grid.Finish();
+    EXPECT_EQ(overlaps(grid, 0, 0, 32, 32), (std::vector<std::size_t>{0, 1, 2}));
+
+    grid.Begin(3);
+    grid.Insert(0, 10, 10);
+    grid.Insert(2, 100, 100);
+    grid.Finish();
+    EXPECT_EQ(overlaps(grid, 0, 0, 32, 32), std::vector<std::size_t>{0});
+    EXPECT_EQ(overlaps(grid, 100, 100, 4, 4), std::vector<std::size_t>{2});
+}
@@ -0,0 +1,154 @@
+/**
+ * Visibility Unit Tests
+ *
+ * Covers shadowcast visibility, the Bresenham RayIsClear() helper, the bounded LRU view cache
+ * and cache invalidation after map damage.
+ */
+
+#include <gtest/gtest.h>
+#include "utils/test_maps.h"
+#include "visibility.h"
+
+namespace {
+const std::vector<std::string> kRoom = {
+    "..........",
+    "..........",
+    "....#.....",
+    "..........",
+    "..........",
+};
+
+// Breaks every subtile of a cell so it becomes walkable.
+void destroy_cell(GameMap& map, int row, int col) {
+    for (int hit = 0; hit < 8 && !map.AreaIsAvailable(row, col); ++hit) {
+        for (int subtile = 0; subtile < GameMap::kSubtilesPerCell; ++subtile) {
+            map.DamageSubtile(row, col, subtile);
+        }
+    }
+}
+}  // namespace
+
+// ===== RayIsClear Tests =====
+
+TEST(VisibilityTest, RayIsClearAcrossOpenFloor) {
+    const auto map = make_test_map(kRoom);
+    const Visibility visibility(5, 10);
+
+    EXPECT_TRUE(visibility.RayIsClear(*map, {0, 0}, {1, 9}));
+    EXPECT_TRUE(visibility.RayIsClear(*map, {4, 9}, {3, 0}));
+    EXPECT_TRUE(visibility.RayIsClear(*map, {3, 3}, {3, 3}));
+    EXPECT_TRUE(visibility.RayIsClear(*map, {0, 2}, {4, 2}));
+}
+
+TEST(VisibilityTest, RayIsClearStopsAtBlockingCells) {
+    const auto map = make_test_map(kRoom);
+    const Visibility visibility(5, 10);
+
+    EXPECT_FALSE(visibility.RayIsClear(*map, {2, 0}, {2, 9}));
+    EXPECT_FALSE(visibility.RayIsClear(*map, {0, 4}, {4, 4}));
+    EXPECT_FALSE(visibility.RayIsClear(*map, {0, 0}, {4, 9}));
+}
+
+TEST(VisibilityTest, RayIsClearIgnoresBlockedEndpoints) {
+    const auto map = make_test_map(kRoom);
+    const Visibility visibility(5, 10);
+
+    EXPECT_TRUE(visibility.RayIsClear(*map, {2, 4}, {2, 9}));
+    EXPECT_TRUE(visibility.RayIsClear(*map, {2, 0}, {2, 4}));
+    EXPECT_TRUE(visibility.RayIsClear(*map, {2, 3}, {2, 4}));
+}
+
+// ===== IsVisible Tests =====
+
+TEST(VisibilityTest, WallsCastShadows) {
+    const auto map = make_test_map(kRoom);
+    Visibility visibility(5, 10);
+
+    EXPECT_TRUE(visibility.IsVisible(*map, {2, 0}, {2, 0}));
+    EXPECT_TRUE(visibility.IsVisible(*map, {2, 0}, {2, 3}));
+    EXPECT_TRUE(visibility.IsVisible(*map, {2, 0}, {2, 4}));
+    EXPECT_FALSE(visibility.IsVisible(*map, {2, 0}, {2, 9}));
+    EXPECT_TRUE(visibility.IsVisible(*map, {2, 0}, {0, 9}));
+    EXPECT_FALSE(visibility.IsVisible(*map, {2, 0}, {5, 0}));
+    EXPECT_FALSE(visibility.IsVisible(*map, {-1, 0}, {2, 0}));
+}
+
+// ===== Cache Tests =====
+
+TEST(VisibilityTest, RepeatedQueriesReuseTheCachedView) {
+    const auto map = make_test_map(kRoom);
+    Visibility visibility(5, 10);
+
+    for (int col = 0; col < 10; ++col) {
+        visibility.IsVisible(*map, {0, 0}, {4, col});
+    }
+    EXPECT_EQ(visibility.ComputedViewCount(), 1u);
+}
+
+TEST(VisibilityTest, CacheEvictsTheLeastRecentlyUsedView) {
+    const auto map = make_test_map(kRoom);
+    Visibility visibility(5, 10, 3);
+    ASSERT_EQ(visibility.CachedViewCapacity(), 3);
+
+    visibility.IsVisible(*map, {0, 0}, {1, 1});
+    visibility.IsVisible(*map, {0, 1}, {1, 1});
+    visibility.IsVisible(*map, {0, 2}, {1, 1});
+    visibility.IsVisible(*map, {0, 0}, {1, 1});  // hit: (0, 1) is now the oldest
+    visibility.IsVisible(*map, {0, 3}, {1, 1});  // evicts (0, 1)
+    EXPECT_EQ(visibility.ComputedViewCount(), 4u);
+
+    visibility.IsVisible(*map, {0, 0}, {1, 1});
+    visibility.IsVisible(*map, {0, 2}, {1, 1});
+    visibility.IsVisible(*map, {0, 3}, {1, 1});
+    EXPECT_EQ(visibility.ComputedViewCount(), 4u);
+
+    visibility.IsVisible(*map, {0, 1}, {1, 1});
+    EXPECT_EQ(visibility.ComputedViewCount(), 5u);
+}
+
+TEST(VisibilityTest, CacheSizeDoesNotDependOnSourceCount) {
+    const auto map = make_test_map(random_layout(20, 32, 0.2, 5));
+    Visibility visibility(20, 32);
+    EXPECT_EQ(visibility.CachedViewCapacity(), Visibility::kDefaultCachedViews);
+
+    for (int row = 0; row < 20; ++row) {
+        for (int col = 0; col < 32; ++col) {
+            visibility.IsVisible(*map, {row, col}, {0, 0});
+        }
+    }
+    EXPECT_EQ(visibility.ComputedViewCount(), 640u);
+    EXPECT_EQ(visibility.CachedViewCapacity(), Visibility::kDefaultCachedViews);
+}
+
+// ===== Invalidation Tests =====
+
+TEST(VisibilityTest, SyncDropsViewsThatSawAChangedCell) {
+    const auto map = make_test_map(kRoom);
+    Visibility visibility(5, 10);
+    visibility.Sync(*map);
+
+    ASSERT_FALSE(visibility.IsVisible(*map, {2, 0}, {2, 9}));
+    destroy_cell(*map, 2, 4);
+    ASSERT_TRUE(map->AreaIsAvailable(2, 4));
+    visibility.Sync(*map);
+
+    EXPECT_TRUE(visibility.IsVisible(*map, {2, 0}, {2, 9}));
+    EXPECT_EQ(visibility.ComputedViewCount(), 2u);
+}
+
+TEST(VisibilityTest, SyncKeepsViewsThatCouldNotSeeTheChange) {
+    const auto map = make_test_map({
+        "....#.....",
+        "....#.....",
+        "....#...#.",
+        "....#.....",
+    });
+    Visibility visibility(4, 10);
+    visibility.Sync(*map);
+
+    visibility.IsVisible(*map, {1, 0}, {1, 3});
+    destroy_cell(*map, 2, 8);
+    visibility.Sync(*map);
+    visibility.IsVisible(*map, {1, 0}, {1, 3});
+    EXPECT_EQ(visibility.ComputedViewCount(), 1u);
+}
@@ -0,0 +1,18 @@
+/**
+ * Allocation Counter for Game Tests
+ *
+ * The test binary replaces the global operator new, so tests can assert that a code path
+ * performs no heap allocations.
+ */
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+/**
+ * Number of operator new calls made by any thread since the program started
+ */
+std::size_t allocation_count();
+
+#endif  // ALLOCATION_COUNTER_H
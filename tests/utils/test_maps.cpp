@@ -0,0 +1,112 @@
+#include "test_maps.h"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace {
+std::atomic<int> g_map_counter{0};
+}  // namespace
+
+std::shared_ptr<GameMap> load_text_map(const std::string& contents, int rows, int cols) {
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() /
+        ("playgame_test_" + std::to_string(g_map_counter.fetch_add(1)) + ".map");
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+    auto map = std::make_shared<GameMap>(rows, cols, TEST_GRID_SIZE, path.string(), 0);
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    return map;
+}
+
+std::shared_ptr<GameMap> make_test_map(const std::vector<std::string>& rows) {
+    std::string contents;
+    for (const std::string& row : rows) {
+        for (std::size_t col = 0; col < row.size(); ++col) {
+            contents += col == 0 ? "" : " ";
+            contents += row[col] == '#' ? '1' : '0';
+        }
+        contents += '\n';
+    }
+    const int cols = rows.empty() ? 0 : static_cast<int>(rows.front().size());
+    return load_text_map(contents, static_cast<int>(rows.size()), cols);
+}
+
+std::vector<std::string> random_layout(int rows, int cols, double blocked_share,
+                                       std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> roll(0.0, 1.0);
+    std::vector<std::string> layout(rows, std::string(cols, '.'));
+    for (std::string& row : layout) {
+        for (char& cell : row) {
+            cell = roll(rng) < blocked_share ? '#' : '.';
+        }
+    }
+    return layout;
+}
+
+std::shared_ptr<GameMap> make_subtile_map(int rows, int cols, double blocked_share,
+                                          std::uint32_t seed) {
+    // Packed entries: low byte tile id, high byte health | destruction << 3.
+    constexpr const char* kBreakableEntry = "0x0901";  // health 1, normal destruction
+    constexpr const char* kFloorEntry = "0x0000";
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> roll(0.0, 1.0);
+    std::string contents;
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            const bool blocked = roll(rng) < blocked_share;
+            contents += col == 0 ? "" : " ";
+            contents += blocked ? "1|" : "0|";
+            for (int i = 0; i < GameMap::kSubtilesPerCell; ++i) {
+                contents += i == 0 ? "" : ",";
+                contents += blocked && roll(rng) < 0.5 ? kBreakableEntry : kFloorEntry;
+            }
+        }
+        contents += '\n';
+    }
+    return load_text_map(contents, rows, cols);
+}
+
+std::vector<int> bfs_distances(const std::vector<std::uint8_t>& walkable, int rows, int cols,
+                               int from) {
+    std::vector<int> distance(walkable.size(), -1);
+    if (from < 0 || from >= static_cast<int>(walkable.size()) || !walkable[from]) {
+        return distance;
+    }
+
+    std::vector<int> queue{from};
+    distance[from] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const int index = queue[head];
+        const int row = index / cols;
+        const int col = index % cols;
+        const int neighbours[4][2] = {
+            {row, col - 1}, {row, col + 1}, {row - 1, col}, {row + 1, col}};
+        for (const auto& next : neighbours) {
+            if (next[0] < 0 || next[1] < 0 || next[0] >= rows || next[1] >= cols) {
+                continue;
+            }
+            const int next_index = next[0] * cols + next[1];
+            if (walkable[next_index] && distance[next_index] < 0) {
+                distance[next_index] = distance[index] + 1;
+                queue.push_back(next_index);
+            }
+        }
+    }
+    return distance;
+}
+
+std::vector<std::uint8_t> cell_walkability(const GameMap& map) {
+    std::vector<std::uint8_t> walkable;
+    walkable.reserve(static_cast<std::size_t>(map.RowCount()) * map.ColCount());
+    for (int row = 0; row < map.RowCount(); ++row) {
+        for (int col = 0; col < map.ColCount(); ++col) {
+            walkable.push_back(map.AreaIsAvailable(row, col) ? 1 : 0);
+        }
+    }
+    return walkable;
+}
@@ -0,0 +1,55 @@
+/**
+ * Map Helpers for Game Tests
+ *
+ * Builds GameMap instances from small ASCII layouts and provides a flat BFS reference to
+ * check the path finding and navigation code against.
+ */
+
+#ifndef TEST_MAPS_H
+#define TEST_MAPS_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gamemap.h"
+
+constexpr int TEST_GRID_SIZE = 32;
+
+/**
+ * Load a map from rows of '#' (blocked) and '.' (floor) characters, all the same width
+ */
+std::shared_ptr<GameMap> make_test_map(const std::vector<std::string>& rows);
+
+/**
+ * Load a map from raw text map contents, exactly as GameMap would read them from disk
+ */
+std::shared_ptr<GameMap> load_text_map(const std::string& contents, int rows, int cols);
+
+/**
+ * Random layout with the given share of blocked cells; the same seed gives the same layout
+ */
+std::vector<std::string> random_layout(int rows, int cols, double blocked_share,
+                                       std::uint32_t seed);
+
+/**
+ * Random map in packed subtile format: a `blocked_share` of the cells are walls, and each of
+ * their subtiles is either open or a one-hit destructible wall with equal odds
+ */
+std::shared_ptr<GameMap> make_subtile_map(int rows, int cols, double blocked_share,
+                                          std::uint32_t seed);
+
+/**
+ * 4-connected BFS distances in steps from `from` over a walkability grid, -1 if unreachable
+ *
+ * @param walkable Row-major walkable flags, `cols` per row
+ */
+std::vector<int> bfs_distances(const std::vector<std::uint8_t>& walkable, int rows, int cols,
+                               int from);
+
+/**
+ * Row-major cell walkability of a map, as reported by AreaIsAvailable()
+ */
+std::vector<std::uint8_t> cell_walkability(const GameMap& map);
+
+#endif  // TEST_MAPS_H